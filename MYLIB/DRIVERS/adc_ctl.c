@@ -0,0 +1,532 @@
+// *****************************************************************************
+// *  File: adc_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the ADC10 driver. A stream
+// *  runs the ADC10 in a repeated conversion mode with the data transfer
+// *  controller in continuous two block mode, the results are written to RAM
+// *  with no CPU involvement and the CPU may sleep between blocks.
+// *
+// *  Timed streams are triggered by the TA0.1 output. The output is set by the
+// *  TACCR1 compare so every trigger edge lands on an exact timer count, the
+// *  compare interrupt only pulls the output low and moves the compare on by
+// *  one sample period.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "adc_ctl.h"
+
+// Private variables defined here
+static uint16_t *StreamBuffer;              //Two blocks of results, block one first
+static uint8_t BlockSize;                   //Results per block
+static bool NextBlockOne;                   //Block expected to be filled next
+static bool Running;
+static bool Timed;                          //Stream paced by Timer A
+static uint16_t SampleHz;                   //Timed sample rate
+static uint16_t SamplePeriod;               //Timed sample period in timer counts
+static uint16_t Overruns;                   //Blocks lost since the last reset
+static uint16_t MissedSamples;              //Timed triggers lost since the last reset
+static ADC__BlockCallback_t BlockCallback;
+
+//Oversampled stream state
+static uint8_t OversampleBits;              //Extra result bits, n of 4^n
+static uint16_t OversampleRemaining;        //Results still to be summed into the output
+static uint32_t OversampleSum;
+static uint16_t OversampleOverruns;         //Overruns seen when the output was started
+static ADC__ResultCallback_t ResultCallback;
+
+//*****************************************************************************
+// Purpose: Clocks the ADC10 needs kept running while the CPU is idle.
+// Argument: None
+// Return: HW__CLOCK_* flags
+//
+//*****************************************************************************
+
+static uint8_t AdcClocks(void)
+{
+    uint8_t clocks;
+
+    switch(ADC__CLOCK_SOURCE)
+    {
+        case ADC10_SOURCE_ACLK:
+            clocks = HW__CLOCK_ACLK;
+            break;
+        case ADC10_SOURCE_MCLK:
+        case ADC10_SOURCE_SMCLK:
+            clocks = HW__CLOCK_SMCLK;
+            break;
+        default:
+            clocks = HW__CLOCK_ADC10OSC;
+            break;
+    }
+
+    return clocks;
+}
+
+//*****************************************************************************
+// Purpose: Analog input enable mask for the channels converted, internal
+//          channels above A7 have no pin.
+// Argument: channel - Channel converted, highest channel of a sequence
+//           sequence - True if the channels down to A0 are converted in turn
+// Return: ADC10AE0 mask
+//
+//*****************************************************************************
+
+static uint8_t AnalogEnableMask(uint8_t channel, bool sequence)
+{
+    uint8_t mask = 0;
+
+    if(sequence)
+    {
+        mask = (channel >= ADC10_MAX_EXTERNAL_CHANNEL) ? 0xFF : (uint8_t)((1 << (channel + 1)) - 1);
+    }
+    else if(channel <= ADC10_MAX_EXTERNAL_CHANNEL)
+    {
+        mask = (uint8_t)(1 << channel);
+    }
+
+    return mask;
+}
+
+//*****************************************************************************
+// Purpose: Sample period in timer counts, rounded to the nearest count.
+// Argument: timer_hz - Timer A clock frequency
+// Return: Sample period, 0 if out of the 16 bit timer range
+//
+//*****************************************************************************
+
+static uint16_t CountsPerSample(uint32_t timer_hz)
+{
+    uint32_t period = (timer_hz + (SampleHz / 2)) / SampleHz;
+
+    return (period > 0xFFFF) ? 0 : (uint16_t)period;
+}
+
+//*****************************************************************************
+// Purpose: Timer A clock change handler, the sample period is recalculated
+//          and the next trigger is one period from now.
+// Argument: timer_hz - New Timer A clock frequency
+// Return: None
+//
+//*****************************************************************************
+
+static void ClockChanged(uint32_t timer_hz)
+{
+    if(Running && Timed)
+    {
+        SamplePeriod = CountsPerSample(timer_hz);
+        HWREG16(TIMERA_TACCR1_REG_ADDR) = HWREG16(TIMERA_TAR_REG_ADDR) + SamplePeriod;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Configure the ADC10 and the data transfer controller for a stream
+//          and start it. Free running streams convert back to back, timed
+//          streams convert one channel per trigger.
+// Argument: channel - ADC10 input channel, highest channel of a sequence
+//           sequence - True to convert the channels down to A0 in turn
+//           trigger - ADC10_TRIGGER_* sample trigger
+//           buffer - Room for two blocks of results
+//           block_size - Results per block
+//           callback - Called with each filled block
+// Return: None
+//
+//*****************************************************************************
+
+static void StartConversions(uint8_t channel, bool sequence, uint16_t trigger, uint16_t *buffer, uint8_t block_size, ADC__BlockCallback_t callback)
+{
+    StreamBuffer = buffer;
+    BlockSize = block_size;
+    BlockCallback = callback;
+    NextBlockOne = true;
+
+    HWREG16(ADC10_CTL1_REG_ADDR) = ((uint16_t)channel << ADC10_CHANNEL_SHIFT) + trigger + ADC__CLOCK_DIVIDE + ADC__CLOCK_SOURCE +
+                                   (sequence ? ADC10_SEQUENCE_REPEAT_CHANNELS : ADC10_SEQUENCE_REPEAT_SINGLE);
+    HWREG16(ADC10_CTL0_REG_ADDR) = ADC__REFERENCE + ADC__SAMPLE_HOLD + ADC10_ON +
+                                   ((trigger == ADC10_TRIGGER_SOFTWARE) ? ADC10_MULTIPLE_SAMPLE : 0);
+    HWREG8(ADC10_AE0_REG_ADDR) = AnalogEnableMask(channel, sequence);
+
+    //Writing the start address arms the data transfer controller, the block
+    //size must be set beforehand
+    HWREG8(ADC10_DTC0_REG_ADDR) = ADC10_DTC_TWO_BLOCK + ADC10_DTC_CONTINUOUS;
+    HWREG8(ADC10_DTC1_REG_ADDR) = block_size;
+    HWREG16(ADC10_SA_REG_ADDR) = HW__DTC_ADDRESS(buffer, 2 * block_size * sizeof(uint16_t));
+
+    Running = true;
+
+    INT__Enable(ADC10_INT);
+    HWREG16(ADC10_CTL0_REG_ADDR) |= ADC10_ENABLE_CONVERSION;
+}
+
+//*****************************************************************************
+// Purpose: Check the arguments common to every stream.
+// Argument: channel - ADC10 input channel
+//           buffer - Result buffer
+//           block_size - Results per block
+// Return: True if valid
+//
+//*****************************************************************************
+
+static bool ValidStream(uint8_t channel, uint16_t *buffer, uint8_t block_size)
+{
+    if(channel > ADC10_MAX_CHANNEL)
+    {
+        LIBUTIL__LogError(ADC__INVALID_CHANNEL);
+        return false;
+    }
+
+    if((block_size == 0) || (buffer == 0))
+    {
+        LIBUTIL__LogError(ADC__INVALID_BLOCK_SIZE);
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Block callback of an oversampled stream, run in the ADC10
+//          interrupt handler. The block is summed in 16 bits and added to the
+//          output sum, which is shifted down to the result once 4^n results
+//          have been summed. An output a lost block would have been part of
+//          is dropped.
+// Argument: block - Conversion results
+//           length - Number of results in the block
+// Return: None
+//
+//*****************************************************************************
+
+static void OversampleBlock(const uint16_t *block, uint8_t length)
+{
+    uint16_t sum = 0;
+    uint8_t index;
+
+    if(OversampleOverruns != Overruns)
+    {
+        OversampleOverruns = Overruns;
+        OversampleRemaining = (uint16_t)1 << (2 * OversampleBits);
+        OversampleSum = 0;
+        return;
+    }
+
+    for(index = 0; index < length; index++)
+    {
+        sum += block[index];
+    }
+
+    OversampleSum += sum;
+    OversampleRemaining -= length;
+
+    if(OversampleRemaining == 0)
+    {
+        OversampleRemaining = (uint16_t)1 << (2 * OversampleBits);
+
+        if(ResultCallback != 0)
+        {
+            ResultCallback((uint16_t)(OversampleSum >> OversampleBits));
+        }
+
+        OversampleSum = 0;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Reset the ADC10 driver with the ADC10 off.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void ADC__Reset(void)
+{
+    ADC__Stop();
+
+    StreamBuffer = 0;
+    BlockSize = 0;
+    Overruns = 0;
+    MissedSamples = 0;
+    BlockCallback = 0;
+    ResultCallback = 0;
+
+    HW__RegisterClockHandler(HW__CLOCK_USER_ADC, ClockChanged);
+}
+
+//*****************************************************************************
+// Purpose: Start streaming conversions into a two block buffer. Conversions
+//          run back to back at the ADC10 clock rate, the callback is called
+//          once per filled block. A running stream is stopped first.
+// Argument: channel - ADC10 input channel, highest channel of a sequence
+//           sequence - True to convert the channels down to A0 in turn
+//           buffer - Room for two blocks of results, must stay valid until
+//                    the stream is stopped
+//           block_size - Results per block, 1 to 255
+//           callback - Called with each filled block
+// Return: True if the stream has been started
+//
+//*****************************************************************************
+
+bool ADC__StartStream(uint8_t channel, bool sequence, uint16_t *buffer, uint8_t block_size, ADC__BlockCallback_t callback)
+{
+    if(!ValidStream(channel, buffer, block_size))
+    {
+        return false;
+    }
+
+    ADC__Stop();
+
+    HW__RequestClocks(HW__CLOCK_USER_ADC, AdcClocks());
+    StartConversions(channel, sequence, ADC10_TRIGGER_SOFTWARE, buffer, block_size, callback);
+    HWREG16(ADC10_CTL0_REG_ADDR) |= ADC10_START_CONVERSION;
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Start streaming conversions paced by Timer A into a two block
+//          buffer, the callback is called once per filled block. Each trigger
+//          converts one channel, so each channel of a sequence is sampled at
+//          sample_hz / (channel + 1). The rate is rounded to whole timer
+//          counts. A running stream is stopped first.
+// Argument: channel - ADC10 input channel, highest channel of a sequence
+//           sequence - True to convert the channels down to A0 in turn
+//           sample_hz - Conversions per second, ADC__MIN_SAMPLE_HZ to
+//                       ADC__MAX_SAMPLE_HZ
+//           buffer - Room for two blocks of results, must stay valid until
+//                    the stream is stopped
+//           block_size - Results per block, 1 to 255
+//           callback - Called with each filled block
+// Return: True if the stream has been started
+//
+//*****************************************************************************
+
+bool ADC__StartTimedStream(uint8_t channel, bool sequence, uint16_t sample_hz, uint16_t *buffer, uint8_t block_size, ADC__BlockCallback_t callback)
+{
+    uint8_t clocks = AdcClocks() + HW__CLOCK_TIMERA;
+    uint16_t state;
+
+    if(!ValidStream(channel, buffer, block_size))
+    {
+        return false;
+    }
+
+    if((sample_hz < ADC__MIN_SAMPLE_HZ) || (sample_hz > ADC__MAX_SAMPLE_HZ))
+    {
+        LIBUTIL__LogError(ADC__INVALID_SAMPLE_RATE);
+        return false;
+    }
+
+    ADC__Stop();
+
+    if(sample_hz > ADC__ACLK_MAX_SAMPLE_HZ)
+    {
+        clocks |= HW__CLOCK_SMCLK;
+    }
+
+    SampleHz = sample_hz;
+    HW__RequestClocks(HW__CLOCK_USER_ADC, clocks);
+
+    state = INT__EnterCritical();
+
+    Timed = true;
+    StartConversions(channel, sequence, ADC10_TRIGGER_TIMERA_OUT1, buffer, block_size, callback);
+
+    //First trigger one period from now
+    SamplePeriod = CountsPerSample(HW__GetTimerClockFrequency());
+    HWREG16(TIMERA_TACCR1_REG_ADDR) = HWREG16(TIMERA_TAR_REG_ADDR) + SamplePeriod;
+    HWREG16(TIMERA_TACCTL1_REG_ADDR) = TIMERA_COMPARE_MODE + TIMERA_OUTMOD_SET;
+    INT__Enable(TIMERA_CC1_INT);
+
+    INT__ExitCritical(state);
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Start an oversampled stream of one channel. Each result is the sum
+//          of 4^n conversions shifted right by n, adding n bits of resolution
+//          at 1/4^n of the sample rate. The data transfer controller moves
+//          the conversions in blocks, the blocks are summed by the ADC10
+//          interrupt handler. A running stream is stopped first.
+// Argument: channel - ADC10 input channel
+//           extra_bits - Extra result bits n, 1 to ADC__MAX_OVERSAMPLE_BITS
+//           sample_hz - Conversions per second paced by Timer A, 0 to
+//                       convert back to back
+//           buffer - Room for two blocks of results, must stay valid until
+//                    the stream is stopped
+//           block_size - Results per block, a power of 2 up to 4^n and
+//                        ADC__MAX_OVERSAMPLE_BLOCK
+//           callback - Called with each result
+// Return: True if the stream has been started
+//
+//*****************************************************************************
+
+bool ADC__StartOversampled(uint8_t channel, uint8_t extra_bits, uint16_t sample_hz, uint16_t *buffer, uint8_t block_size, ADC__ResultCallback_t callback)
+{
+    uint16_t samples = (uint16_t)1 << (2 * extra_bits);
+
+    if((extra_bits == 0) || (extra_bits > ADC__MAX_OVERSAMPLE_BITS))
+    {
+        LIBUTIL__LogError(ADC__INVALID_OVERSAMPLING);
+        return false;
+    }
+
+    //Whole blocks make up each output
+    if((block_size > ADC__MAX_OVERSAMPLE_BLOCK) || (block_size > samples) || (block_size & (block_size - 1)))
+    {
+        LIBUTIL__LogError(ADC__INVALID_BLOCK_SIZE);
+        return false;
+    }
+
+    ADC__Stop();
+
+    OversampleBits = extra_bits;
+    OversampleRemaining = samples;
+    OversampleSum = 0;
+    OversampleOverruns = Overruns;
+    ResultCallback = callback;
+
+    if(sample_hz == 0)
+    {
+        return ADC__StartStream(channel, false, buffer, block_size, OversampleBlock);
+    }
+
+    return ADC__StartTimedStream(channel, false, sample_hz, buffer, block_size, OversampleBlock);
+}
+
+//*****************************************************************************
+// Purpose: Stop the stream straight away and turn the ADC10 off. The
+//          conversion in progress is lost.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void ADC__Stop(void)
+{
+    INT__Disable(ADC10_INT);
+
+    if(Timed)
+    {
+        INT__Disable(TIMERA_CC1_INT);
+        HWREG16(TIMERA_TACCTL1_REG_ADDR) = TIMERA_COMPARE_MODE + TIMERA_OUTMOD_OUT;
+        Timed = false;
+    }
+
+    //Repeated modes only stop at once with the sequence mode cleared
+    HWREG16(ADC10_CTL1_REG_ADDR) &= ~ADC10_SEQUENCE_MASK;
+    HWREG16(ADC10_CTL0_REG_ADDR) &= ~ADC10_ENABLE_CONVERSION;
+    HWREG16(ADC10_CTL0_REG_ADDR) = 0;
+
+    HWREG8(ADC10_DTC1_REG_ADDR) = 0;
+    HWREG8(ADC10_DTC0_REG_ADDR) = 0;
+    HWREG8(ADC10_AE0_REG_ADDR) = 0;
+
+    HW__RequestClocks(HW__CLOCK_USER_ADC, HW__CLOCK_NONE);
+    Running = false;
+}
+
+//*****************************************************************************
+// Purpose: Check whether a stream is running.
+// Argument: None
+// Return: True if a stream is running
+//
+//*****************************************************************************
+
+bool ADC__IsRunning(void)
+{
+    return Running;
+}
+
+//*****************************************************************************
+// Purpose: Read the number of blocks lost because the block interrupt was not
+//          serviced before the other block had been filled as well.
+// Argument: None
+// Return: Lost blocks since the driver was reset
+//
+//*****************************************************************************
+
+uint16_t ADC__GetOverruns(void)
+{
+    return Overruns;
+}
+
+//*****************************************************************************
+// Purpose: Read the number of timed triggers lost because the compare
+//          interrupt was serviced too late to set up the next one in time.
+// Argument: None
+// Return: Lost triggers since the driver was reset
+//
+//*****************************************************************************
+
+uint16_t ADC__GetMissedSamples(void)
+{
+    return MissedSamples;
+}
+
+//*****************************************************************************
+// Purpose: ADC10 interrupt handler, called once a block has been filled. The
+//          block flag tells which one, a block other than the one expected
+//          means a block interrupt has been missed and its results overwritten.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void ADC__BlockHandler(void)
+{
+    bool blockOne = ((HWREG8(ADC10_DTC0_REG_ADDR) & ADC10_DTC_BLOCK_ONE) != 0);
+
+    if(!Running)
+    {
+        return;
+    }
+
+    if(blockOne != NextBlockOne)
+    {
+        Overruns++;
+        LIBUTIL__LogError(ADC__BLOCK_OVERRUN);
+    }
+
+    NextBlockOne = !blockOne;
+
+    if(BlockCallback != 0)
+    {
+        BlockCallback(blockOne ? StreamBuffer : (StreamBuffer + BlockSize), BlockSize);
+    }
+}
+
+//*****************************************************************************
+// Purpose: TACCR1 compare interrupt handler, called after a timed trigger
+//          edge. The output is pulled low ready for the next edge one sample
+//          period on. A compare already passed by the time it is written would
+//          only be reached after a whole timer wrap, the sample clock is
+//          restarted from the current count instead. A zero period, out of
+//          the timer range, is refused at start and never divided by.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void ADC__SampleClockHandler(void)
+{
+    uint16_t next = HWREG16(TIMERA_TACCR1_REG_ADDR) + SamplePeriod;
+    uint16_t now;
+
+    HWREG16(TIMERA_TACCTL1_REG_ADDR) = TIMERA_COMPARE_MODE + TIMERA_OUTMOD_OUT + TIMERA_CCIE_MASK;
+    HWREG16(TIMERA_TACCTL1_REG_ADDR) = TIMERA_COMPARE_MODE + TIMERA_OUTMOD_SET + TIMERA_CCIE_MASK;
+    HWREG16(TIMERA_TACCR1_REG_ADDR) = next;
+
+    now = HWREG16(TIMERA_TAR_REG_ADDR);
+
+    if((SamplePeriod != 0) && ((uint16_t)(next - now - 1) >= SamplePeriod) && !(HWREG16(TIMERA_TACCTL1_REG_ADDR) & TIMERA_CCIFG_MASK))
+    {
+        MissedSamples += ((uint16_t)(now - next) / SamplePeriod) + 1;
+        HWREG16(TIMERA_TACCR1_REG_ADDR) = HWREG16(TIMERA_TAR_REG_ADDR) + SamplePeriod;
+    }
+}
@@ -0,0 +1,107 @@
+// *****************************************************************************
+// *  File: adc_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the ADC10 driver. Continuous sampling streams
+// *  conversion results into a two block RAM buffer through the data transfer
+// *  controller, the CPU is only interrupted once a block has been filled.
+// *  Streams either convert back to back or are paced by Timer A, and may be
+// *  oversampled for results of up to 14 bits.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _ADC_CTL_H_
+#define _ADC_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_ADC_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//ADC10 clock, the ADC10 oscillator runs on demand in every low power mode.
+//Free running streams convert at ADC10CLK / (sample and hold time + 13),
+//about 43ksps with the nominal 5MHz oscillator divided by 4.
+#define ADC__CLOCK_SOURCE                   ADC10_SOURCE_ADC10OSC
+#define ADC__CLOCK_DIVIDE                   ADC10_DIVIDE(4)
+#define ADC__SAMPLE_HOLD                    ADC10_SAMPLE_HOLD_16
+#define ADC__REFERENCE                      ADC10_REF_AVCC
+
+//Fastest timed sample rate, a conversion must be complete before the next
+//trigger. Sample and hold of 16 plus 13 conversion clocks at 4 / 3.7MHz, the
+//slowest ADC10 oscillator.
+#define ADC__MAX_SAMPLE_HZ                  30000
+
+//Slowest timed sample rate, the sample period must fit the 16 bit timer at
+//the fastest Timer A clock, SMCLK from the 16MHz DCO
+#define ADC__MIN_SAMPLE_HZ                  245
+
+//Fastest timed sample rate paced from ACLK, faster rates hold Timer A on
+//SMCLK for a finer sample period and limit idle to LPM0
+#define ADC__ACLK_MAX_SAMPLE_HZ             1024
+
+//Oversampling adds one bit of resolution per factor of 4 in samples, up to
+//14 bit results from 256 samples. Input noise of at least 1/2 LSB is needed
+//to dither the ADC10 between codes.
+#define ADC__MAX_OVERSAMPLE_BITS            4
+
+//Largest block of an oversampled stream, the block sum of 10 bit results is
+//kept to 16 bits
+#define ADC__MAX_OVERSAMPLE_BLOCK           64
+
+#define ADC__INVALID_CHANNEL                90
+#define ADC__INVALID_BLOCK_SIZE             91
+#define ADC__BLOCK_OVERRUN                  92  //A block was filled before the previous one was handed over
+#define ADC__INVALID_SAMPLE_RATE            93
+#define ADC__INVALID_OVERSAMPLING           94
+
+//*****************************************************************************
+//
+// Driver data types defined here
+//
+//*****************************************************************************
+
+//Block callback, called from the ADC10 interrupt handler with the block just
+//filled. The data transfer controller is filling the other block meanwhile,
+//so the block must be handled before that one is full. Results of a channel
+//sequence are interleaved, highest channel first.
+//block - Conversion results
+//length - Number of results in the block
+typedef void (*ADC__BlockCallback_t)(const uint16_t *block, uint8_t length);
+
+//Oversampled result callback, called from the ADC10 interrupt handler
+//result - Sum of 4^n results shifted right by n, a 10 + n bit result
+typedef void (*ADC__ResultCallback_t)(uint16_t result);
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void ADC__Reset(void);
+bool ADC__StartStream(uint8_t channel, bool sequence, uint16_t *buffer, uint8_t block_size, ADC__BlockCallback_t callback);
+bool ADC__StartTimedStream(uint8_t channel, bool sequence, uint16_t sample_hz, uint16_t *buffer, uint8_t block_size, ADC__BlockCallback_t callback);
+bool ADC__StartOversampled(uint8_t channel, uint8_t extra_bits, uint16_t sample_hz, uint16_t *buffer, uint8_t block_size, ADC__ResultCallback_t callback);
+void ADC__Stop(void);
+bool ADC__IsRunning(void);
+uint16_t ADC__GetOverruns(void);
+uint16_t ADC__GetMissedSamples(void);
+void ADC__BlockHandler(void);
+void ADC__SampleClockHandler(void);
+
+#endif //_ADC_CTL_H_
@@ -0,0 +1,43 @@
+// *****************************************************************************
+// *  File: crystal_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the crystal oscillator
+// *  monitor. A fault is reported by the oscillator fault NMI as it happens,
+// *  recovery is found by polling as the fault flag stays set while the
+// *  crystal is down.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "crystal_ctl.h"
+
+//*****************************************************************************
+// Purpose: Soft timer callback, checks whether a faulty crystal has settled.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void PollTimerExpired(void)
+{
+    HW__PollCrystal();
+}
+
+//*****************************************************************************
+// Purpose: Start polling the crystal. Must be called after the soft timer
+//          service has been reset.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void CRYSTAL__Reset(void)
+{
+    SOFTTMR__RegisterCallback(SOFTTMR__RES_1S, CRYSTAL_SOFT_TIMER, PollTimerExpired, CRYSTAL__POLL_PERIOD, SOFTTMR__AUTO_RELOAD);
+}
@@ -0,0 +1,44 @@
+// *****************************************************************************
+// *  File: crystal_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the crystal oscillator monitor. Boot only
+// *  waits a bounded time for the LFXT1 crystal, the timers run from the DCO
+// *  until the crystal has settled and fall back to it on an oscillator fault.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _CRYSTAL_CTL_H_
+#define _CRYSTAL_CTL_H_
+
+#include "hardware_ctl.h"
+#include "softtimer_ctl.h"
+#include <stdint.h>
+
+#define COMPILED_CRYSTAL_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//Crystal poll interval in 1s soft timer ticks, the crystal must run a whole
+//interval without a fault to be taken as settled
+#define CRYSTAL__POLL_PERIOD                1
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void CRYSTAL__Reset(void);
+
+#endif //_CRYSTAL_CTL_H_
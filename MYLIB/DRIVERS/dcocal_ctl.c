@@ -0,0 +1,330 @@
+// *****************************************************************************
+// *  File: dcocal_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the DCO self calibration
+// *  driver. Timer A CC0 is borrowed from the soft timer service for the
+// *  duration of a measurement, with interrupts disabled. Soft timer ticks
+// *  due meanwhile are caught up afterwards, the timer counts at the trial
+// *  frequencies while a tune is in progress so soft timer and uptime
+// *  intervals spanning a tune are not exact.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "dcocal_ctl.h"
+
+typedef struct {
+    uint16_t state;             //Interrupt state to restore
+    uint16_t tacctl0;           //Soft timer compare configuration
+    uint16_t taccr0;            //Soft timer compare value
+    uint16_t start;             //Timer count when CC0 was borrowed
+    uint8_t bcsctl1;            //ACLK divider to restore
+} Measurement_t;
+
+//*****************************************************************************
+// Purpose: Convert a frequency to the timer count expected over one
+//          measurement.
+// Argument: hz - DCO frequency in Hz
+// Return: Timer counts per measurement
+//
+//*****************************************************************************
+
+static inline uint16_t TargetCount(uint32_t hz)
+{
+    return (uint16_t)((hz * DCOCAL__ACLK_PERIODS) / DCOCAL__ACLK_HZ);
+}
+
+//*****************************************************************************
+// Purpose: Borrow Timer A CC0 from the soft timer service and configure it to
+//          capture the divided ACLK. Timer A is held on SMCLK so it counts
+//          the DCO under test.
+// Argument: measurement - Saved state, restored by EndMeasurement
+// Return: None
+//
+//*****************************************************************************
+
+static void StartMeasurement(Measurement_t *measurement)
+{
+    HW__RequestClocks(HW__CLOCK_USER_DCOCAL, HW__CLOCK_SMCLK);
+
+    measurement->state = INT__EnterCritical();
+    measurement->tacctl0 = HWREG16(TIMERA_TACCTL0_REG_ADDR);
+    measurement->taccr0 = HWREG16(TIMERA_TACCR0_REG_ADDR);
+    measurement->start = HWREG16(TIMERA_TAR_REG_ADDR);
+    measurement->bcsctl1 = HWREG8(BCS_CONTROL_REG1_ADDR);
+
+    HWREG8(BCS_CONTROL_REG1_ADDR) = (measurement->bcsctl1 & ~ACLK_DIVIDE_MASK) | DCOCAL__ACLK_DIVIDE;
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) = TIMERA_CAP_RISING + TIMERA_CCIS_B + TIMERA_SCS_MASK + TIMERA_CAPTURE_MODE;
+}
+
+//*****************************************************************************
+// Purpose: Hand Timer A CC0 back to the soft timer service. A compare point
+//          passed while it was borrowed is flagged, so the soft timer catches
+//          up as soon as interrupts are restored.
+// Argument: measurement - State saved by StartMeasurement
+// Return: None
+//
+//*****************************************************************************
+
+static void EndMeasurement(Measurement_t *measurement)
+{
+    uint16_t elapsed = HWREG16(TIMERA_TAR_REG_ADDR) - measurement->start;
+
+    HWREG8(BCS_CONTROL_REG1_ADDR) = (HWREG8(BCS_CONTROL_REG1_ADDR) & ~ACLK_DIVIDE_MASK) | (measurement->bcsctl1 & ACLK_DIVIDE_MASK);
+    HWREG16(TIMERA_TACCR0_REG_ADDR) = measurement->taccr0;
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) = measurement->tacctl0;
+
+    if((uint16_t)(measurement->taccr0 - measurement->start) <= elapsed)
+    {
+        HWREG16(TIMERA_TACCTL0_REG_ADDR) |= TIMERA_CCIFG_MASK;
+    }
+
+    INT__ExitCritical(measurement->state);
+    HW__RequestClocks(HW__CLOCK_USER_DCOCAL, HW__CLOCK_NONE);
+}
+
+//*****************************************************************************
+// Purpose: Measure the DCO over one divided ACLK period.
+// Argument: None
+// Return: Timer counts per measurement, zero if ACLK is not running
+//
+//*****************************************************************************
+
+static uint16_t Measure(void)
+{
+    uint16_t start = 0;
+    uint16_t timeout;
+    uint8_t edge;
+
+    //The first edge only starts the measurement, the DCO settles meanwhile
+    for(edge = 0; edge < 2; edge++)
+    {
+        HWREG16(TIMERA_TACCTL0_REG_ADDR) &= ~TIMERA_CCIFG_MASK;
+
+        for(timeout = DCOCAL__EDGE_TIMEOUT; !(HWREG16(TIMERA_TACCTL0_REG_ADDR) & TIMERA_CCIFG_MASK); timeout--)
+        {
+            if(timeout == 0)
+            {
+                return 0;
+            }
+        }
+
+        if(edge == 0)
+        {
+            start = HWREG16(TIMERA_TACCR0_REG_ADDR);
+        }
+    }
+
+    return (HWREG16(TIMERA_TACCR0_REG_ADDR) - start);
+}
+
+//*****************************************************************************
+// Purpose: Measure the DCO at a trial setting.
+// Argument: dcoctl - DCOCTL setting
+//           rsel - BCSCTL1 range select
+// Return: Timer counts per measurement, zero if ACLK is not running
+//
+//*****************************************************************************
+
+static uint16_t MeasureSetting(uint8_t dcoctl, uint8_t rsel)
+{
+    HW__WriteDcoSetting(dcoctl, rsel);
+
+    return Measure();
+}
+
+//*****************************************************************************
+// Purpose: Start the periodic re-tune of the DCO.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void DCOCAL__Reset(void)
+{
+    SOFTTMR__RegisterCallback(SOFTTMR__RES_1S, DCOCAL_SOFT_TIMER, DCOCAL__Retune, DCOCAL__RETUNE_PERIOD, SOFTTMR__AUTO_RELOAD);
+}
+
+//*****************************************************************************
+// Purpose: Search for the DCO setting closest to a target frequency. The range
+//          select is found first at the middle DCO tap, then DCOCTL is
+//          searched within the range, both by bisection. The DCO is put back
+//          to its previous setting afterwards. Interrupts are disabled for
+//          the 14 measurements. Each one waits for a first ACLK / 8 edge
+//          and then a whole 244us period, so 3.4ms to 6.8ms in all.
+// Argument: target_hz - Target DCO frequency in Hz, any frequency within the
+//                       DCO range
+//           dcoctl - DCOCTL setting found
+//           bcsctl1 - BCSCTL1 range select found
+// Return: True if a setting within tolerance was found
+//
+//*****************************************************************************
+
+bool DCOCAL__Tune(uint32_t target_hz, uint8_t *dcoctl, uint8_t *bcsctl1)
+{
+    Measurement_t measurement;
+    uint16_t target = TargetCount(target_hz);
+    uint16_t below;
+    uint16_t above;
+    uint8_t dcoctlSaved;
+    uint8_t rsel = 0;
+    uint8_t dco = 0;
+    uint8_t bit;
+    bool found = false;
+
+    if(!HW__IsCrystalRunning())
+    {
+        LIBUTIL__LogError(DCOCAL__NO_REFERENCE_CLOCK);
+        return false;
+    }
+
+    StartMeasurement(&measurement);
+    dcoctlSaved = HWREG8(DCO_CONTROL_REG_ADDR);
+
+    //Highest range not above the target, then the highest DCOCTL not above it
+    for(bit = 0x08; bit != 0; bit >>= 1)
+    {
+        if(MeasureSetting(DCOCAL__DCOCTL_MID, rsel | bit) <= target)
+        {
+            rsel |= bit;
+        }
+    }
+
+    for(bit = 0x80; bit != 0; bit >>= 1)
+    {
+        if(MeasureSetting(dco | bit, rsel) <= target)
+        {
+            dco |= bit;
+        }
+    }
+
+    //Take whichever of the settings either side of the target is closer
+    below = MeasureSetting(dco, rsel);
+    above = (dco < 0xFF) ? MeasureSetting(dco + 1, rsel) : 0;
+
+    if(below != 0)
+    {
+        if((above > target) && ((above - target) < (target - below)))
+        {
+            dco++;
+            below = above;
+        }
+
+        found = ((below > target) ? (below - target) : (target - below)) <= (target >> DCOCAL__TUNE_TOLERANCE_SHIFT);
+    }
+
+    HW__WriteDcoSetting(dcoctlSaved, measurement.bcsctl1);
+    EndMeasurement(&measurement);
+
+    if(below == 0)
+    {
+        LIBUTIL__LogError(DCOCAL__NO_REFERENCE_CLOCK);
+    }
+    else if(!found)
+    {
+        LIBUTIL__LogError(DCOCAL__TARGET_OUT_OF_RANGE);
+    }
+
+    *dcoctl = dco;
+    *bcsctl1 = rsel;
+
+    return found;
+}
+
+//*****************************************************************************
+// Purpose: Tune one of the calibrated DCO frequencies and cache the setting in
+//          information memory, later boots and HW__SetDcoFrequency use it in
+//          place of the factory calibration. The new setting is loaded if the
+//          DCO is running at that frequency.
+// Argument: frequency - HW__DCO_* frequency
+// Return: True if the frequency was tuned and cached
+//
+//*****************************************************************************
+
+bool DCOCAL__Calibrate(uint8_t frequency)
+{
+    uint8_t cache[2 * HW__NUM_DCO_FREQUENCIES];
+    uint8_t index;
+
+    if(frequency >= HW__NUM_DCO_FREQUENCIES)
+    {
+        LIBUTIL__LogError(DCOCAL__INVALID_FREQUENCY);
+        return false;
+    }
+
+    //The segment is erased as a whole, keep the other cached settings
+    for(index = 0; index < sizeof(cache); index++)
+    {
+        cache[index] = HWREG8(CAL_CACHE_ADDR + index);
+    }
+
+    if(!DCOCAL__Tune(HW__GetDcoFrequencyHz(frequency), &cache[2 * frequency], &cache[(2 * frequency) + 1]))
+    {
+        return false;
+    }
+
+    HW__WriteInfoSegment(CAL_CACHE_ADDR, cache, sizeof(cache));
+
+    if(HW__GetSmclkFrequency() == HW__GetDcoFrequencyHz(frequency))
+    {
+        HW__SetDcoFrequency(frequency);
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Track temperature drift, the DCO is measured at its current setting
+//          and moved by one modulation step towards the nominal frequency if
+//          out of tolerance. Run from the re-tune soft timer, interrupts are
+//          disabled for two ACLK measurement periods.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void DCOCAL__Retune(void)
+{
+    Measurement_t measurement;
+    uint16_t target = TargetCount(HW__GetSmclkFrequency());
+    uint16_t tolerance = target >> DCOCAL__RETUNE_TOLERANCE_SHIFT;
+    uint16_t count;
+    uint8_t dcoctl;
+
+    if(!HW__IsCrystalRunning())
+    {
+        return;
+    }
+
+    if(tolerance < DCOCAL__RETUNE_MIN_TOLERANCE)
+    {
+        tolerance = DCOCAL__RETUNE_MIN_TOLERANCE;
+    }
+
+    StartMeasurement(&measurement);
+
+    count = Measure();
+    dcoctl = HWREG8(DCO_CONTROL_REG_ADDR);
+
+    if((count > (target + tolerance)) && (dcoctl > 0))
+    {
+        HWREG8(DCO_CONTROL_REG_ADDR) = dcoctl - 1;
+    }
+    else if((count != 0) && ((count + tolerance) < target) && (dcoctl < 0xFF))
+    {
+        HWREG8(DCO_CONTROL_REG_ADDR) = dcoctl + 1;
+    }
+
+    EndMeasurement(&measurement);
+
+    if(count == 0)
+    {
+        LIBUTIL__LogError(DCOCAL__NO_REFERENCE_CLOCK);
+    }
+}
@@ -0,0 +1,80 @@
+// *****************************************************************************
+// *  File: dcocal_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the DCO self calibration driver. The DCO is
+// *  measured against the 32768Hz ACLK crystal with a Timer A capture on
+// *  CCI0B, so frequencies without factory calibration data can be tuned in
+// *  system and kept on frequency as the temperature drifts.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _DCOCAL_CTL_H_
+#define _DCOCAL_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "softtimer_ctl.h"
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_DCOCAL_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//Reference clock
+#define DCOCAL__ACLK_HZ                     HW__ACLK_HZ
+
+//ACLK is divided while measuring so one captured period spans 8 crystal
+//periods, 244us. Long enough to resolve one DCOCTL modulation step at 1MHz,
+//short enough to fit the timer range at 16MHz.
+#define DCOCAL__ACLK_DIVIDE                 ACLK_DIVIDE_8
+#define DCOCAL__ACLK_PERIODS                8
+
+//Polling loops to wait for an ACLK edge before the crystal is taken as failed
+#define DCOCAL__EDGE_TIMEOUT                0x2000
+
+//DCOCTL setting the range search is made at, DCO tap 3 with no modulation
+#define DCOCAL__DCOCTL_MID                  0x60
+
+//Re-tune interval in 1s soft timer ticks, each re-tune moves the DCO one
+//modulation step towards the nominal frequency
+#define DCOCAL__RETUNE_PERIOD               60
+
+//Measured error allowed before a re-tune step, as a right shift of the
+//target count (1/256, 0.4%). Never less than the +/-1 count quantisation of
+//a measurement, the shift alone gives no tolerance below about 4MHz
+#define DCOCAL__RETUNE_TOLERANCE_SHIFT      8
+#define DCOCAL__RETUNE_MIN_TOLERANCE        1
+
+//Largest error of a tuned setting, as a right shift of the target count
+//(1/64, 1.6%). A larger error means the target is outside the DCO range.
+#define DCOCAL__TUNE_TOLERANCE_SHIFT        6
+
+#define DCOCAL__NO_REFERENCE_CLOCK          70
+#define DCOCAL__TARGET_OUT_OF_RANGE         71
+#define DCOCAL__INVALID_FREQUENCY           72
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void DCOCAL__Reset(void);
+bool DCOCAL__Tune(uint32_t target_hz, uint8_t *dcoctl, uint8_t *bcsctl1);
+bool DCOCAL__Calibrate(uint8_t frequency);
+void DCOCAL__Retune(void);
+
+#endif //_DCOCAL_CTL_H_
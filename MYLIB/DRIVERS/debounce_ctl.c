@@ -0,0 +1,162 @@
+// *****************************************************************************
+// *  File: debounce_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the GPIO input debounce
+// *  driver. Each sample costs the same handful of byte operations per port
+// *  no matter how many of its pins are debounced.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "debounce_ctl.h"
+
+typedef struct {
+    uint8_t state;              //Debounced input state, 1 for active
+    uint8_t count0;             //Vertical counter bit 0
+    uint8_t count1;             //Vertical counter bit 1
+    uint8_t pin_mask;           //Pins being debounced
+    uint8_t active_low_mask;    //Pins which are active when LOW
+    DEBOUNCE__Callback_t callback;
+} DebouncePort_t;
+
+// Private variables defined here
+static DebouncePort_t DebouncePort[DEBOUNCE__NUM_PORTS];
+
+//*****************************************************************************
+// Purpose: Soft timer callback, samples the inputs every sample period.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void SampleTimerExpired(void)
+{
+    DEBOUNCE__Sample();
+}
+
+//*****************************************************************************
+// Purpose: Reset the debounce driver with no pins configured and start the
+//          sample timer.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void DEBOUNCE__Reset(void)
+{
+    uint8_t index;
+
+    for(index = 0; index < DEBOUNCE__NUM_PORTS; index++)
+    {
+        DebouncePort[index].state = 0;
+        DebouncePort[index].count0 = 0;
+        DebouncePort[index].count1 = 0;
+        DebouncePort[index].pin_mask = 0;
+        DebouncePort[index].active_low_mask = 0;
+        DebouncePort[index].callback = 0;
+    }
+
+    SOFTTMR__RegisterCallback(SOFTTMR__RES_10MS, DEBOUNCE_SOFT_TIMER, SampleTimerExpired, DEBOUNCE__SAMPLE_PERIOD, SOFTTMR__AUTO_RELOAD);
+}
+
+//*****************************************************************************
+// Purpose: Configure the debounced pins of a port. The debounced state of the
+//          pins starts from their current input level.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to debounce
+//           active_low_mask - Pins which are active when LOW, e.g. buttons
+//                             with pull up resistors
+//           callback - Called with press and release events, may be null
+// Return: None
+//
+//*****************************************************************************
+
+void DEBOUNCE__Configure(uint8_t port, uint8_t pin_mask, uint8_t active_low_mask, DEBOUNCE__Callback_t callback)
+{
+    DebouncePort_t *debounce;
+
+    if((port > 0) && (port <= DEBOUNCE__NUM_PORTS))
+    {
+        debounce = &DebouncePort[port - 1];
+
+        debounce->pin_mask = pin_mask;
+        debounce->active_low_mask = active_low_mask;
+        debounce->state = (GPIO_portRead(port) ^ active_low_mask) & pin_mask;
+        debounce->count0 = 0;
+        debounce->count1 = 0;
+        debounce->callback = callback;
+    }
+    else
+    {
+        LIBUTIL__LogError(DEBOUNCE__INVALID_PORT);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Read the debounced state of a port.
+// Argument: port - MSP port ID
+// Return: Debounced pin state, a set bit for a pin at its active level
+//
+//*****************************************************************************
+
+uint8_t DEBOUNCE__Read(uint8_t port)
+{
+    uint8_t state = 0;
+
+    if((port > 0) && (port <= DEBOUNCE__NUM_PORTS))
+    {
+        state = DebouncePort[port - 1].state;
+    }
+    else
+    {
+        LIBUTIL__LogError(DEBOUNCE__INVALID_PORT);
+    }
+
+    return state;
+}
+
+//*****************************************************************************
+// Purpose: Take one debounce sample of every configured port. Each pin has a
+//          2 bit counter which runs while its input differs from the
+//          debounced state and is cleared when it matches again, the state
+//          changes when the counter wraps after 4 differing samples.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void DEBOUNCE__Sample(void)
+{
+    DebouncePort_t *debounce;
+    uint8_t delta;
+    uint8_t changed;
+    uint8_t index;
+
+    for(index = 0; index < DEBOUNCE__NUM_PORTS; index++)
+    {
+        debounce = &DebouncePort[index];
+
+        if(debounce->pin_mask != 0)
+        {
+            delta = ((GPIO_portRead(index + 1) ^ debounce->active_low_mask) & debounce->pin_mask) ^ debounce->state;
+
+            //Vertical counter increment, cleared for pins with no difference
+            debounce->count1 = (debounce->count1 ^ debounce->count0) & delta;
+            debounce->count0 = ~debounce->count0 & delta;
+
+            changed = delta & ~(debounce->count0 | debounce->count1);
+            debounce->state ^= changed;
+
+            if((changed != 0) && (debounce->callback != 0))
+            {
+                debounce->callback(index + 1, changed & debounce->state, changed & ~debounce->state);
+            }
+        }
+    }
+}
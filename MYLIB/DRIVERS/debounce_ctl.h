@@ -0,0 +1,67 @@
+// *****************************************************************************
+// *  File: debounce_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the GPIO input debounce driver. Inputs are
+// *  integrated with vertical counters, one 2 bit counter per pin held across
+// *  three bytes per port, so all pins of a port are debounced together.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _DEBOUNCE_CTL_H_
+#define _DEBOUNCE_CTL_H_
+
+#include "gpio.h"
+#include "softtimer_ctl.h"
+#include "libUtility.h"
+#include <stdint.h>
+
+#define COMPILED_DEBOUNCE_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//Sample interval in 10ms soft timer ticks, an input must be stable for 4
+//consecutive samples to change the debounced state
+#define DEBOUNCE__SAMPLE_PERIOD             1
+
+//Ports from port 1 up which can be debounced, 8 bytes of RAM each
+#ifndef DEBOUNCE__NUM_PORTS
+#define DEBOUNCE__NUM_PORTS                 1
+#endif
+
+#define DEBOUNCE__INVALID_PORT              60
+
+//*****************************************************************************
+//
+// Driver data types defined here
+//
+//*****************************************************************************
+
+//Debounced event callback, called from the soft timer callback task
+//port - MSP port ID
+//pressed - Pins which changed to their active level
+//released - Pins which changed to their inactive level
+typedef void (*DEBOUNCE__Callback_t)(uint8_t port, uint8_t pressed, uint8_t released);
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void DEBOUNCE__Reset(void);
+void DEBOUNCE__Configure(uint8_t port, uint8_t pin_mask, uint8_t active_low_mask, DEBOUNCE__Callback_t callback);
+uint8_t DEBOUNCE__Read(uint8_t port);
+void DEBOUNCE__Sample(void);
+
+#endif //_DEBOUNCE_CTL_H_
@@ -1,452 +1,704 @@
-// *****************************************************************************
-// *  File: gpio.c
-// *
-// *  Purpose:                                                                         
-// *  Basic GPIO driver and wrapper functions are defined here in this module.
-// *
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 27/08/2016  
-// *
-// *
-// *
-// *****************************************************************************
-
-#include "gpio.h"
-#include "main.h"
-
-#if defined(__MSP430_HAS_PORT1_R__) || defined(__MSP430_HAS_PORT2_R__) || \
-    defined(__MSP430_HAS_PORTA_R__)
-
-static const uint16_t GPIO_Port_To_Base[] = {
-    0x00,
-#if defined(__MSP430_HAS_PORT1_R__)
-    MSP430_PORT1_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT2_R__)
-    MSP430_PORT2_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT3_R__)
-    MSP430_PORT3_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT4_R__)
-    MSP430_PORT4_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT5_R__)
-    MSP430_PORT5_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT6_R__)
-    MSP430_PORT6_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT7_R__)
-    MSP430_PORT7_ADDR,
-#else
-    0xFFFF,
-#endif
-#if defined(__MSP430_HAS_PORT8_R__)
-    MSP430_PORT8_ADDR,
-#else
-    0xFFFF,
-#endif
-    (MAX_NUM_PORTS + 1)  //Array size stored here
-};
-
-#else
-    #error "gpio.c: Device IO ports not avaailable!"
-#endif
-
-//*****************************************************************************
-// Purpose: Inline function to map generic IO pin id to specific device port and pin.
-// Argument: Generic IO ID
-// Return: io_port (struct)
-//         port - Device port mapped with generic pin ID
-//         pin - Device pin mapped to generic pin ID
-//
-//*****************************************************************************
-
-static inline Port_t map_id_to_port(uint8_t generic_pin_id) 
-{
-    Port_t io_port;
-
-    //Derive port from pin ID
-    io_port.port = (uint8_t)(generic_pin_id/MAX_NUM_PIN) + 1;
-
-    //Derive pin from pin ID
-    io_port.pin = generic_pin_id - (MAX_NUM_PIN*(io_port.port-1));
-
-    return io_port;
-}
-
-//*****************************************************************************
-// Purpose: This function configures the specified pin as output.
-// Argument: port - Device port for which pin resides
-//           pin - Device pin for which to set
-// Return: None
-//
-//*****************************************************************************
-
-static void setOutputPin(uint8_t port, uint8_t pin) 
-{
-    uint8_t index;
-    uint16_t base_address;
-  
-    //Check port and pin validity
-    if(port <= MAX_NUM_PORTS) 
-    {
-        if(pin <= MAX_NUM_PIN) 
-        {
-            index = port;
-            base_address = GPIO_Port_To_Base[index];
-      
-            //Configure register
-            if(base_address != 0xFFFF) 
-            {
-                HWREG16(base_address + OFS_PDIR) |= (1 << pin);
-            }
-        }
-    }
-}
-
-//*****************************************************************************
-//
-// Purpose: This function configures the specified pin as input.
-// Argument: port - Device port for which pin resides
-//           pin - Device pin for which to set
-// Return: None
-//
-//*****************************************************************************
-
-static void setInputPin(uint8_t port, uint8_t pin) 
-{
-    uint8_t index;
-    uint16_t base_address;
-
-    //Check port and pin validity
-    if((port <= MAX_NUM_PORTS) && (port > 0)) 
-    {
-        if((pin <= MAX_NUM_PIN) && (pin > 0)) 
-        {
-            index = port;
-      
-            base_address = GPIO_Port_To_Base[index];
-      
-            //Configure register
-            if(base_address != 0xFFFF) 
-            {
-                HWREG16(base_address + OFS_PDIR) &= ~(1 << pin);
-            }
-        }
-    }
-}
-
-//*****************************************************************************
-//
-// Purpose: This function configures the specified pin internal resistor pull
-//          configurations.
-// Argument: port - Device port for which pin resides
-//           pin - Device pin for which to set
-//           gpio_config - set value
-//                         ENABLE_PULL - Enable pull resistor
-//                         DISABLE_PULL - Disable pull resistors
-// Return: None
-//
-//*****************************************************************************
-
-static inline void setPinPull(uint8_t port, uint8_t pin, uint8_t gpio_config) 
-{
-    uint16_t base_address = GPIO_Port_To_Base[port];
-
-    if(base_address != 0xFFFF) 
-    {
-        if(gpio_config == ENABLE_PULL) 
-        {
-
-            //Enable pin pull resistor register
-            HWREG16(base_address + OFS_PREN) |= (1 << pin);
-        }
-        else if(gpio_config == DISABLE_PULL) 
-        {
-
-            //Disable pin pull resistor register
-            HWREG16(base_address + OFS_PREN) &= ~(1 << pin);
-        }
-    }
-    else 
-    {
-        LIBUTIL__LogError(GPIO_INVALID_PORT_ACCESS);
-    } 
-}
-
-
-//*****************************************************************************
-//
-// Purpose: Reset and initialises the GPIO registers.
-// Argument None
-// Return: None
-//
-//*****************************************************************************
-
-void GPIO_reset(void) 
-{
-    uint16_t base_address;
-    uint8_t index;
-
-    for(index = 0; index < MSP_PORT_AVAILABLE; index++) 
-    {
-        base_address = GPIO_Port_To_Base[index];
-
-        //Set all pin status and state to input as per pin reset state
-        HWREG16(base_address + OFS_PDIR) = 0;
-
-        //Set all pin output values to LOW
-        HWREG16(base_address + OFS_POUT) = 0;
-
-        //Set all pin status and state to have internal pull resistors disabled
-        HWREG16(base_address + OFS_PREN) = 0;
-    }
-}
-
-//*****************************************************************************
-//
-// Purpose: This function configures the specified pin direction and internal
-// pull resistors.
-// Argument: gpio_pin_id - Generic IO ID
-//           gpio_config - Configuration to configure
-// Return: None
-//
-//*****************************************************************************
-
-void GPIO_configurePin(uint8_t gpio_pin_id, uint8_t gpio_config) 
-{
-    Port_t io_port;
-
-    if((gpio_pin_id < TOTAL_PIN) && (gpio_config <= DISABLE_PULL)) 
-    {
-
-        //Decode required device port and pin
-        io_port = map_id_to_port(gpio_pin_id);
-
-        switch(gpio_config) 
-        {
-
-            case SET_AS_OUTPUT:
-                setOutputPin(io_port.port, io_port.pin);
-                break;
-
-            case SET_AS_INPUT:
-                setInputPin(io_port.port, io_port.pin);
-                break;
-
-            case ENABLE_PULL:
-                setPinPull(io_port.port, io_port.pin, ENABLE_PULL);
-                break;
-
-            case DISABLE_PULL:
-                setPinPull(io_port.port, io_port.pin, DISABLE_PULL);
-                break;
-
-            default:
-                LIBUTIL__LogError(GPIO_INVALID_CONFIG_ARGUMENT);
-        }
-    }
-    else 
-    {
-        LIBUTIL__LogError(GPIO_INVALID_CONFIG_ARGUMENT);
-    }
-}
-
-//*****************************************************************************
-//
-// Purpose: This function writes digital value to specified pin.
-// Argument: gpio_pin_id - Generic IO ID
-//           output_value - logical value specified to be set to output
-//                          (LOGIC_HIGHH) - output HIGH
-//                          (LOGIC_LOW) - output LOW
-// Return: None
-//
-//*****************************************************************************
-
-void GPIO_pinWrite(uint8_t gpio_pin_id, uint8_t output_value) 
-{
-    Port_t io_port;
-
-    if(gpio_pin_id <= GPIO_IOID13) 
-    {
-        //Decode required device port and pin
-        io_port = map_id_to_port(gpio_pin_id);
-
-        if(output_value == LOGIC_HIGH) 
-        {
-            HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_POUT) |= (1 << io_port.pin);
-        }
-        else if(output_value == LOGIC_LOW) 
-        {
-            HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_POUT) &= ~(1 << io_port.pin);
-        }
-    }
-    else 
-    {
-        //Do nothing
-    }
-}
-
-//*****************************************************************************
-//
-// Purpose: This function reads digital value from specified pin.
-// Argument: gpio_pin_id - Generic IO ID
-// Return: Pin input logical value as a byte, a zero for LOW and none zero
-// for a HIGH. THis byte can be bit tested to determine the pin
-//
-//*****************************************************************************
-
-uint8_t GPIO_pinRead(uint8_t gpio_pin_id) 
-{
-    Port_t io_port;
-    uint8_t pin_val = 0;
-
-    if(gpio_pin_id <= GPIO_IOID13) 
-    {
-        //Decode required device port and pin
-        io_port = map_id_to_port(gpio_pin_id);
-
-        pin_val = HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_PIN) & (1 << io_port.pin);
-    }
-    else 
-    {
-        //Do nothing
-    }
-
-    return pin_val;
-}
-
-//*****************************************************************************
-//
-// Purpose: GPIO interrupt event handler for port 1.
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void GPIO_Port1_Event_Handler(void) 
-{
-    uint8_t interrupt_flg = 0;
-
-    interrupt_flg = HWREG8(GPIO_Port_To_Base[1] + OFS_IFG) & 0xFF;  //Copy the content the ports interrupt flag register
-
-    //Determine the interrupt source pin and perform required task for that pin
-    //also check that the associated pin has interrupt enable
-    if((interrupt_flg & GPIO_IFG0) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG0)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG1) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG1)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG2) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG2)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG3) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG3)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG4) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG4)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG5) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG5)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG6) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG6)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG7) && (HWREG8(GPIO_Port_To_Base[1] + OFS_IE) & GPIO_IFG7)) 
-    {
-        //Do something
-    }
-
-    HWREG8(GPIO_Port_To_Base[1] + OFS_IFG) &= 0x00;  //Clear the interrupt flag, all interrupts have been handled
-}
-
-//*****************************************************************************
-//
-// Purpose: GPIO interrupt event handler for port 2.
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void GPIO_Port2_Event_Handler(void) 
-{
-    uint8_t interrupt_flg = 0;
-
-    interrupt_flg = HWREG8(GPIO_Port_To_Base[2] + OFS_IFG) & 0xFF;  //Copy the content the ports interrupt flag register
-
-    //Determine the interrupt source pin and perform required task for that pin
-    //also check that the associated pin has interrupt enable
-    if((interrupt_flg & GPIO_IFG0) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG0)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG1) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG1)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG2) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG2)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG3) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG3)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG4) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG4)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG5) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG5)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG6) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG6)) 
-    {
-        //Do something
-    }
-
-    if((interrupt_flg & GPIO_IFG7) && (HWREG8(GPIO_Port_To_Base[2] + OFS_IE) & GPIO_IFG7)) 
-    {
-        //Do something
-    }
-
-    HWREG8(GPIO_Port_To_Base[2] + OFS_IFG) &= 0x00;  //Clear the interrupt flag, all interrupts have been handled
-}
-
-
+// *****************************************************************************
+// *  File: gpio.c
+// *
+// *  Purpose:                                                                         
+// *  Basic GPIO driver and wrapper functions are defined here in this module.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 27/08/2016  
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "gpio.h"
+#include "main.h"
+
+#if defined(__MSP430_HAS_PORT1_R__) || defined(__MSP430_HAS_PORT2_R__) || \
+    defined(__MSP430_HAS_PORTA_R__)
+
+static const uint16_t GPIO_Port_To_Base[] = {
+    0x00,
+    GPIO_PORT1_BASE,
+    GPIO_PORT2_BASE,
+    GPIO_PORT3_BASE,
+    GPIO_PORT4_BASE,
+    GPIO_PORT5_BASE,
+    GPIO_PORT6_BASE,
+    GPIO_PORT7_BASE,
+    GPIO_PORT8_BASE,
+    (MAX_NUM_PORTS + 1)  //Array size stored here
+};
+
+#else
+    #error "gpio.c: Device IO ports not avaailable!"
+#endif
+
+#if (GPIO_NUM_CALLBACK_PINS > 0)
+//Pin interrupt callbacks, indexed by generic pin ID
+static GPIO_Callback_t GPIO_Pin_Callback[GPIO_NUM_CALLBACK_PINS];
+#endif
+
+#if (GPIO_TIMESTAMP_BUFFER_SIZE > 0)
+//Timestamped edge ring buffers, written by the port interrupt handler and
+//read by the main loop
+typedef struct {
+    GPIO_Edge_t edge[GPIO_TIMESTAMP_BUFFER_SIZE];
+    volatile uint8_t head;      //Only written by the port interrupt handler
+    volatile uint8_t tail;      //Only written by GPIO_readEdges
+    uint8_t pin_mask;           //Pins with timestamping enabled
+} Edge_Buffer_t;
+
+static Edge_Buffer_t GPIO_Edge_Buffer[TOTAL_PORT];
+#endif
+
+//*****************************************************************************
+// Purpose: Inline function to map generic IO pin id to specific device port and pin.
+// Argument: Generic IO ID
+// Return: io_port (struct)
+//         port - Device port mapped with generic pin ID
+//         pin - Device pin mapped to generic pin ID
+//
+//*****************************************************************************
+
+static inline Port_t map_id_to_port(uint8_t generic_pin_id) 
+{
+    Port_t io_port;
+
+    //Derive port from pin ID
+    io_port.port = GPIO_PIN_TO_PORT(generic_pin_id);
+
+    //Derive pin from pin ID
+    io_port.pin = GPIO_PIN_TO_BIT(generic_pin_id);
+
+    return io_port;
+}
+
+//*****************************************************************************
+// Purpose: This function configures the specified pin as output.
+// Argument: port - Device port for which pin resides
+//           pin - Device pin for which to set
+// Return: None
+//
+//*****************************************************************************
+
+static void setOutputPin(uint8_t port, uint8_t pin) 
+{
+    uint8_t index;
+    uint16_t base_address;
+  
+    //Check port and pin validity
+    if(port <= MAX_NUM_PORTS) 
+    {
+        if(pin <= MAX_NUM_PIN) 
+        {
+            index = port;
+            base_address = GPIO_Port_To_Base[index];
+      
+            //Configure register
+            if(base_address != 0xFFFF) 
+            {
+                HWREG16(base_address + OFS_PDIR) |= (1 << pin);
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function configures the specified pin as input.
+// Argument: port - Device port for which pin resides
+//           pin - Device pin for which to set
+// Return: None
+//
+//*****************************************************************************
+
+static void setInputPin(uint8_t port, uint8_t pin) 
+{
+    uint8_t index;
+    uint16_t base_address;
+
+    //Check port and pin validity
+    if((port <= MAX_NUM_PORTS) && (port > 0)) 
+    {
+        if((pin <= MAX_NUM_PIN) && (pin > 0)) 
+        {
+            index = port;
+      
+            base_address = GPIO_Port_To_Base[index];
+      
+            //Configure register
+            if(base_address != 0xFFFF) 
+            {
+                HWREG16(base_address + OFS_PDIR) &= ~(1 << pin);
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function configures the specified pin internal resistor pull
+//          configurations.
+// Argument: port - Device port for which pin resides
+//           pin - Device pin for which to set
+//           gpio_config - set value
+//                         ENABLE_PULL - Enable pull resistor
+//                         DISABLE_PULL - Disable pull resistors
+// Return: None
+//
+//*****************************************************************************
+
+static inline void setPinPull(uint8_t port, uint8_t pin, uint8_t gpio_config) 
+{
+    uint16_t base_address = GPIO_Port_To_Base[port];
+
+    if(base_address != 0xFFFF) 
+    {
+        if(gpio_config == ENABLE_PULL) 
+        {
+
+            //Enable pin pull resistor register
+            HWREG16(base_address + OFS_PREN) |= (1 << pin);
+        }
+        else if(gpio_config == DISABLE_PULL) 
+        {
+
+            //Disable pin pull resistor register
+            HWREG16(base_address + OFS_PREN) &= ~(1 << pin);
+        }
+    }
+    else 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_PORT_ACCESS);
+    } 
+}
+
+
+//*****************************************************************************
+//
+// Purpose: Reset and initialises the GPIO registers.
+// Argument None
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_reset(void) 
+{
+    uint16_t base_address;
+    uint8_t index;
+
+    for(index = 0; index < MSP_PORT_AVAILABLE; index++) 
+    {
+        base_address = GPIO_Port_To_Base[index];
+
+        //Set all pin status and state to input as per pin reset state
+        HWREG16(base_address + OFS_PDIR) = 0;
+
+        //Set all pin output values to LOW
+        HWREG16(base_address + OFS_POUT) = 0;
+
+        //Set all pin status and state to have internal pull resistors disabled
+        HWREG16(base_address + OFS_PREN) = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function configures the specified pin direction and internal
+// pull resistors.
+// Argument: gpio_pin_id - Generic IO ID
+//           gpio_config - Configuration to configure
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_configurePin(uint8_t gpio_pin_id, uint8_t gpio_config) 
+{
+    Port_t io_port;
+
+    if((gpio_pin_id < TOTAL_PIN) && (gpio_config <= DISABLE_PULL)) 
+    {
+
+        //Decode required device port and pin
+        io_port = map_id_to_port(gpio_pin_id);
+
+        switch(gpio_config) 
+        {
+
+            case SET_AS_OUTPUT:
+                setOutputPin(io_port.port, io_port.pin);
+                break;
+
+            case SET_AS_INPUT:
+                setInputPin(io_port.port, io_port.pin);
+                break;
+
+            case ENABLE_PULL:
+                setPinPull(io_port.port, io_port.pin, ENABLE_PULL);
+                break;
+
+            case DISABLE_PULL:
+                setPinPull(io_port.port, io_port.pin, DISABLE_PULL);
+                break;
+
+            default:
+                LIBUTIL__LogError(GPIO_INVALID_CONFIG_ARGUMENT);
+        }
+    }
+    else 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_CONFIG_ARGUMENT);
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function writes digital value to specified pin.
+// Argument: gpio_pin_id - Generic IO ID
+//           output_value - logical value specified to be set to output
+//                          (LOGIC_HIGHH) - output HIGH
+//                          (LOGIC_LOW) - output LOW
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_pinWrite(uint8_t gpio_pin_id, uint8_t output_value) 
+{
+    Port_t io_port;
+
+    if(gpio_pin_id <= GPIO_IOID13) 
+    {
+        //Decode required device port and pin
+        io_port = map_id_to_port(gpio_pin_id);
+
+        if(output_value == LOGIC_HIGH) 
+        {
+            HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_POUT) |= (1 << io_port.pin);
+        }
+        else if(output_value == LOGIC_LOW) 
+        {
+            HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_POUT) &= ~(1 << io_port.pin);
+        }
+    }
+    else 
+    {
+        //Do nothing
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function reads digital value from specified pin.
+// Argument: gpio_pin_id - Generic IO ID
+// Return: Pin input logical value as a byte, a zero for LOW and none zero
+// for a HIGH. THis byte can be bit tested to determine the pin
+//
+//*****************************************************************************
+
+uint8_t GPIO_pinRead(uint8_t gpio_pin_id) 
+{
+    Port_t io_port;
+    uint8_t pin_val = 0;
+
+    if(gpio_pin_id <= GPIO_IOID13) 
+    {
+        //Decode required device port and pin
+        io_port = map_id_to_port(gpio_pin_id);
+
+        pin_val = HWREG16(GPIO_Port_To_Base[io_port.port] + OFS_PIN) & (1 << io_port.pin);
+    }
+    else 
+    {
+        //Do nothing
+    }
+
+    return pin_val;
+}
+
+//*****************************************************************************
+//
+// Purpose: Inline function to look up the register base address of a port.
+// Argument: port - MSP port ID
+// Return: Port base address, 0xFFFF if the port is not available
+//
+//*****************************************************************************
+
+static inline uint16_t getPortBase(uint8_t port) 
+{
+    uint16_t base_address = 0xFFFF;
+
+    if((port > 0) && (port <= TOTAL_PORT)) 
+    {
+        base_address = GPIO_Port_To_Base[port];
+    }
+
+    if(base_address == 0xFFFF) 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_PORT_ACCESS);
+    }
+
+    return base_address;
+}
+
+//*****************************************************************************
+//
+// Purpose: This function configures groups of pins from a configuration
+//          table. Each entry configures all of its masked pins with a single
+//          register access.
+// Argument: config_table - Port configuration entries
+//           num_entries - Number of entries in the table
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_configurePort(const GPIO_PortConfig_t *config_table, uint8_t num_entries) 
+{
+    uint16_t base_address;
+    uint8_t index;
+
+    for(index = 0; index < num_entries; index++) 
+    {
+        base_address = getPortBase(config_table[index].port);
+
+        if(base_address != 0xFFFF) 
+        {
+            switch(config_table[index].gpio_config) 
+            {
+                case SET_AS_OUTPUT:
+                    HWREG8(base_address + OFS_PDIR) |= config_table[index].pin_mask;
+                    break;
+
+                case SET_AS_INPUT:
+                    HWREG8(base_address + OFS_PDIR) &= ~config_table[index].pin_mask;
+                    break;
+
+                case ENABLE_PULL:
+                    HWREG8(base_address + OFS_PREN) |= config_table[index].pin_mask;
+                    break;
+
+                case DISABLE_PULL:
+                    HWREG8(base_address + OFS_PREN) &= ~config_table[index].pin_mask;
+                    break;
+
+                default:
+                    LIBUTIL__LogError(GPIO_INVALID_CONFIG_ARGUMENT);
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function writes a value to the masked pins of a port, pins
+//          outside of the mask are left unchanged.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to write
+//           value - Output value, one bit per pin
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_portWrite(uint8_t port, uint8_t pin_mask, uint8_t value) 
+{
+    uint16_t base_address = getPortBase(port);
+
+    if(base_address != 0xFFFF) 
+    {
+        HWREG8(base_address + OFS_POUT) = (HWREG8(base_address + OFS_POUT) & ~pin_mask) | (value & pin_mask);
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function drives the masked pins of a port HIGH.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to set
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_portSet(uint8_t port, uint8_t pin_mask) 
+{
+    uint16_t base_address = getPortBase(port);
+
+    if(base_address != 0xFFFF) 
+    {
+        HWREG8(base_address + OFS_POUT) |= pin_mask;
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function drives the masked pins of a port LOW.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to clear
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_portClear(uint8_t port, uint8_t pin_mask) 
+{
+    uint16_t base_address = getPortBase(port);
+
+    if(base_address != 0xFFFF) 
+    {
+        HWREG8(base_address + OFS_POUT) &= ~pin_mask;
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function toggles the output of the masked pins of a port.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to toggle
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_portToggle(uint8_t port, uint8_t pin_mask) 
+{
+    uint16_t base_address = getPortBase(port);
+
+    if(base_address != 0xFFFF) 
+    {
+        HWREG8(base_address + OFS_POUT) ^= pin_mask;
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function reads the input value of all pins of a port.
+// Argument: port - MSP port ID
+// Return: Port input value, one bit per pin
+//
+//*****************************************************************************
+
+uint8_t GPIO_portRead(uint8_t port) 
+{
+    uint16_t base_address = getPortBase(port);
+    uint8_t port_val = 0;
+
+    if(base_address != 0xFFFF) 
+    {
+        port_val = HWREG8(base_address + OFS_PIN);
+    }
+
+    return port_val;
+}
+
+#if (GPIO_NUM_CALLBACK_PINS > 0)
+
+//*****************************************************************************
+//
+// Purpose: This function registers a callback to be run from the port
+//          interrupt handler when the specified pin interrupt flag is set.
+// Argument: gpio_pin_id - Generic IO ID, below GPIO_NUM_CALLBACK_PINS
+//           callback - Function called with the pin ID, null to unregister
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_registerCallback(uint8_t gpio_pin_id, GPIO_Callback_t callback) 
+{
+    if(gpio_pin_id < GPIO_NUM_CALLBACK_PINS) 
+    {
+        GPIO_Pin_Callback[gpio_pin_id] = callback;
+    }
+    else 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_PIN_ID);
+    }
+}
+
+#endif
+
+#if (GPIO_TIMESTAMP_BUFFER_SIZE > 0)
+
+//*****************************************************************************
+//
+// Purpose: This function enables edge timestamping for pins of a port. The
+//          pins must also have their interrupt enabled. Timer A is held on
+//          SMCLK while any pin is timestamped, so the timestamps of all edges
+//          are in the same unit. Idle is limited to LPM0 meanwhile.
+// Argument: port - MSP port ID
+//           pin_mask - Pins to timestamp, replaces the current setting
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_timestampEnable(uint8_t port, uint8_t pin_mask) 
+{
+    uint8_t clocks = HW__CLOCK_NONE;
+    uint8_t index;
+
+    if((port > 0) && (port <= TOTAL_PORT)) 
+    {
+        GPIO_Edge_Buffer[port - 1].pin_mask = pin_mask;
+
+        for(index = 0; index < TOTAL_PORT; index++)
+        {
+            if(GPIO_Edge_Buffer[index].pin_mask != 0)
+            {
+                clocks = HW__CLOCK_SMCLK + HW__CLOCK_TIMERA;
+            }
+        }
+
+        HW__RequestClocks(HW__CLOCK_USER_GPIO, clocks);
+    }
+    else 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_PORT_ACCESS);
+    }
+}
+
+//*****************************************************************************
+//
+// Purpose: This function copies timestamped edges of a port out of its ring
+//          buffer, oldest edge first.
+// Argument: port - MSP port ID
+//           edge_buffer - Destination for the edges
+//           max_edges - Size of the destination buffer
+// Return: Number of edges copied
+//
+//*****************************************************************************
+
+uint8_t GPIO_readEdges(uint8_t port, GPIO_Edge_t *edge_buffer, uint8_t max_edges) 
+{
+    Edge_Buffer_t *buffer;
+    uint8_t num_edges = 0;
+
+    if((port > 0) && (port <= TOTAL_PORT)) 
+    {
+        buffer = &GPIO_Edge_Buffer[port - 1];
+
+        while((num_edges < max_edges) && (buffer->tail != buffer->head)) 
+        {
+            edge_buffer[num_edges] = buffer->edge[buffer->tail];
+            buffer->tail = (buffer->tail + 1) & GPIO_TIMESTAMP_BUFFER_MASK;
+            num_edges++;
+        }
+    }
+    else 
+    {
+        LIBUTIL__LogError(GPIO_INVALID_PORT_ACCESS);
+    }
+
+    return num_edges;
+}
+
+//*****************************************************************************
+//
+// Purpose: Push the timestamped edges of the pending pins into a port edge
+//          buffer, lowest pin first. Edges are dropped when the buffer is full.
+// Argument: buffer - Port edge buffer
+//           pending - Serviced pin interrupt flags
+//           edge_select - Port edge select register, set for falling edge
+//           timestamp - Timer A count sampled on handler entry
+// Return: None
+//
+//*****************************************************************************
+
+static inline void storeEdges(Edge_Buffer_t *buffer, uint8_t pending, uint8_t edge_select, uint16_t timestamp) 
+{
+    uint8_t head;
+    uint8_t pin;
+
+    pending &= buffer->pin_mask;
+
+    while(pending != 0) 
+    {
+        pin = LIBUTIL__LowestSetBit(pending);
+        pending &= (pending - 1);
+        head = (buffer->head + 1) & GPIO_TIMESTAMP_BUFFER_MASK;
+
+        if(head == buffer->tail) 
+        {
+            LIBUTIL__LogError(GPIO_TIMESTAMP_OVERFLOW);
+            break;
+        }
+
+        buffer->edge[buffer->head].timestamp = timestamp;
+        buffer->edge[buffer->head].pin = pin;
+        buffer->edge[buffer->head].falling = edge_select & (1 << pin);
+        buffer->head = head;    //Publish the edge after it is written
+    }
+}
+
+#endif
+
+//*****************************************************************************
+//
+// Purpose: Dispatch the pending pin interrupts of a port to the registered pin
+//          callbacks. Only the serviced flags are cleared, and they are cleared
+//          before the callbacks run so edges arriving meanwhile are kept.
+// Argument: port - Device port which raised the interrupt
+// Return: None
+//
+//*****************************************************************************
+
+static inline void dispatchPortInterrupt(uint8_t port) 
+{
+#if (GPIO_TIMESTAMP_BUFFER_SIZE > 0)
+    uint16_t timestamp = HWREG16(TIMERA_TAR_REG_ADDR);  //Sampled first to keep edge latency low
+#endif
+    uint16_t base_address = GPIO_Port_To_Base[port];
+    uint8_t first_pin_id = (port - 1) * MAX_NUM_PIN;
+    uint8_t pending;
+    uint8_t pin;
+
+    //Only pins with interrupt enabled are serviced
+    pending = HWREG8(base_address + OFS_IFG) & HWREG8(base_address + OFS_IE);
+    HWREG8(base_address + OFS_IFG) &= ~pending;
+
+#if (GPIO_TIMESTAMP_BUFFER_SIZE > 0)
+    if(pending & GPIO_Edge_Buffer[port - 1].pin_mask) 
+    {
+        storeEdges(&GPIO_Edge_Buffer[port - 1], pending, HWREG8(base_address + OFS_PIES), timestamp);
+    }
+#endif
+
+#if (GPIO_NUM_CALLBACK_PINS > 0)
+    //Visit the pending pins only, lowest pin first
+    while(pending != 0) 
+    {
+        pin = LIBUTIL__LowestSetBit(pending);
+        pending &= (pending - 1);
+
+        if(((first_pin_id + pin) < GPIO_NUM_CALLBACK_PINS) && (GPIO_Pin_Callback[first_pin_id + pin] != 0)) 
+        {
+            GPIO_Pin_Callback[first_pin_id + pin](first_pin_id + pin);
+        }
+    }
+#else
+    (void)first_pin_id;
+    (void)pin;
+#endif
+}
+
+//*****************************************************************************
+//
+// Purpose: GPIO interrupt event handler for port 1.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_Port1_Event_Handler(void) 
+{
+    dispatchPortInterrupt(MSP_PORT1);
+}
+
+//*****************************************************************************
+//
+// Purpose: GPIO interrupt event handler for port 2.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void GPIO_Port2_Event_Handler(void) 
+{
+    dispatchPortInterrupt(MSP_PORT2);
+}
@@ -1,161 +1,320 @@
-// *****************************************************************************
-// *  File: gpio.h
-// *
-// *  Purpose:                                                                         
-// *  GPIO driver header file, constants and driver configurations defined here.   
-// *
-// *  By: Kevin Wong
-// *  Revision 1.0 
-// *  Date: 27/08/2016  
-// *
-// *
-// *
-// *****************************************************************************
- 
-#ifndef _GPIO_H_
-#define _GPIO_H_
-
-#include "hardware_ctl.h"
-#include "libUtility.h"
-#include <stdint.h>
-#include <stdbool.h>
-
-#define COMPILED_GPIO_CTL
-
-//*****************************************************************************
-//
-// Generic constants defined here. 
-// 
-//
-//*****************************************************************************
-
-#define MAX_NUM_PORTS   8  //Maximum number of definable ports possible
-#define MAX_NUM_PIN     8  //Maximum number of available IO pins per port
-#define TOTAL_PORT      MSP_PORT_AVAILABLE  //Total available ports for device
-#define TOTAL_PIN		(TOTAL_PORT * MAX_NUM_PIN)  //Total number of available pins for device
-#define LOGIC_HIGH		1
-#define LOGIC_LOW		0
-
-//*****************************************************************************
-//
-// GPIO error flags defined here.
-// 
-//
-//*****************************************************************************
-
-#define GPIO_INVALID_CONFIG_ARGUMENT	100
-#define GPIO_INVALID_PIN_ID				101
-#define GPIO_INVALID_PORT_ACCESS		102
-
-//*****************************************************************************
-//
-// Port specific constants defined here.
-// 
-//
-//*****************************************************************************
-
-//GPIO Configuration settings
-#define SET_AS_OUTPUT		0  //GPIO config, set pin as output
-#define SET_AS_INPUT		1  //GPIO config, set pin as input
-#define ENABLE_PULL			2  //GPIO config, enable pin pull resistor
-#define DISABLE_PULL		3  //GPIO config, disable pin pull resistor
-
-
-//*****************************************************************************
-//
-// MSP pin ID are defined here, use these to select desired pin for gpio 
-// functions.
-//
-//*****************************************************************************
-
-#define MSP_PORT_IO0    (0x01)
-#define MSP_PORT_IO1    (0x01 << 1)
-#define MSP_PORT_IO2    (0x01 << 2)
-#define MSP_PORT_IO3    (0x01 << 3)
-#define MSP_PORT_IO4    (0x01 << 4)
-#define MSP_PORT_IO5    (0x01 << 5)
-#define MSP_PORT_IO6    (0x01 << 6)
-#define MSP_PORT_IO7    (0x01 << 7)
-
-//*****************************************************************************
-//
-// MSP port ID are defined here, use these to select desired port for gpio 
-// functions.
-//
-//*****************************************************************************
-
-#define MSP_PORT1    1
-#define MSP_PORT2    2
-#define MSP_PORT3    3
-#define MSP_PORT4    4
-#define MSP_PORT5    5
-#define MSP_PORT6    6
-#define MSP_PORT7    7
-#define MSP_PORT8    8
-
-//*****************************************************************************
-//
-// Generic pin ID defined here, use these to configure the indivdual pin
-// settings.
-//
-//*****************************************************************************
-
-#define GPIO_IOID0		0
-#define GPIO_IOID1		1
-#define GPIO_IOID2		2
-#define GPIO_IOID3		3
-#define GPIO_IOID4		4
-#define GPIO_IOID5		5
-#define GPIO_IOID6		6
-#define GPIO_IOID7		7
-#define GPIO_IOID8		8
-#define GPIO_IOID9		9
-#define GPIO_IOID10		10
-#define GPIO_IOID11		11
-#define GPIO_IOID12		12
-#define GPIO_IOID13		13
-
-#ifdef __MSP430_HAS_PORT3_R__
-  	#ifdef __MSP430_HAS_PORT3__
-    	#error "gpio.h: GPIO_IOID for port 3 and above not defined yet!"
-  	#endif
-#endif
-
-//*****************************************************************************
-//
-// GPIO interrupt flag identifier
-//
-//*****************************************************************************
-
-#define GPIO_IFG0      (0x01)
-#define GPIO_IFG1      (0x01 << 1)
-#define GPIO_IFG2      (0x01 << 2)
-#define GPIO_IFG3      (0x01 << 3)
-#define GPIO_IFG4      (0x01 << 4)
-#define GPIO_IFG5      (0x01 << 5)
-#define GPIO_IFG6      (0x01 << 6)
-#define GPIO_IFG7      (0x01 << 7)
-
-
-typedef struct {
-	uint8_t port;
-  	uint8_t pin;
-} Port_t;
-
-//*****************************************************************************
-//
-// Function prototype defined here
-// 
-//*****************************************************************************
-
-static void setOutputPin(uint8_t port, uint8_t pin);
-static void setInputPin(uint8_t port, uint8_t pin);
-static inline void setPinPull(uint8_t port, uint8_t pin, uint8_t gpio_config);
-void GPIO_reset(void);
-void GPIO_configurePin(uint8_t gpio_pin_id, uint8_t gpio_config);
-void GPIO_pinWrite(uint8_t gpio_pin_id, uint8_t output_value);
-uint8_t GPIO_pinRead(uint8_t gpio_pin_id);
-void GPIO_Port1_Event_Handler(void);
-void GPIO_Port2_Event_Handler(void);
-
-#endif  //_GPIO_H_
+// *****************************************************************************
+// *  File: gpio.h
+// *
+// *  Purpose:                                                                         
+// *  GPIO driver header file, constants and driver configurations defined here.   
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0 
+// *  Date: 27/08/2016  
+// *
+// *
+// *
+// *****************************************************************************
+ 
+#ifndef _GPIO_H_
+#define _GPIO_H_
+
+#include "hardware_ctl.h"
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_GPIO_CTL
+
+//*****************************************************************************
+//
+// Generic constants defined here. 
+// 
+//
+//*****************************************************************************
+
+#define MAX_NUM_PORTS   8  //Maximum number of definable ports possible
+#define MAX_NUM_PIN     8  //Maximum number of available IO pins per port
+#define TOTAL_PORT      MSP_PORT_AVAILABLE  //Total available ports for device
+#define TOTAL_PIN		(TOTAL_PORT * MAX_NUM_PIN)  //Total number of available pins for device
+#define LOGIC_HIGH		1
+#define LOGIC_LOW		0
+
+//*****************************************************************************
+//
+// GPIO error flags defined here.
+// 
+//
+//*****************************************************************************
+
+#define GPIO_INVALID_CONFIG_ARGUMENT	100
+#define GPIO_INVALID_PIN_ID				101
+#define GPIO_INVALID_PORT_ACCESS		102
+#define GPIO_TIMESTAMP_OVERFLOW			103
+
+//*****************************************************************************
+//
+// Port specific constants defined here.
+// 
+//
+//*****************************************************************************
+
+//GPIO Configuration settings
+#define SET_AS_OUTPUT		0  //GPIO config, set pin as output
+#define SET_AS_INPUT		1  //GPIO config, set pin as input
+#define ENABLE_PULL			2  //GPIO config, enable pin pull resistor
+#define DISABLE_PULL		3  //GPIO config, disable pin pull resistor
+
+//Timestamped edge ring buffer size per port, power of 2. The buffers take
+//4 bytes of RAM per edge plus 3 per port, 0 leaves edge timestamping out.
+#ifndef GPIO_TIMESTAMP_BUFFER_SIZE
+#define GPIO_TIMESTAMP_BUFFER_SIZE	0
+#endif
+#define GPIO_TIMESTAMP_BUFFER_MASK	(GPIO_TIMESTAMP_BUFFER_SIZE - 1)
+
+//Pins from GPIO_IOID0 up which can have an interrupt callback, a pointer of
+//RAM each. Port 1 only by default, port 2 of the G2x21 only has the crystal
+//pins. 0 leaves pin callbacks out.
+#ifndef GPIO_NUM_CALLBACK_PINS
+#define GPIO_NUM_CALLBACK_PINS		MAX_NUM_PIN
+#endif
+
+
+//*****************************************************************************
+//
+// MSP pin ID are defined here, use these to select desired pin for gpio 
+// functions.
+//
+//*****************************************************************************
+
+#define MSP_PORT_IO0    (0x01)
+#define MSP_PORT_IO1    (0x01 << 1)
+#define MSP_PORT_IO2    (0x01 << 2)
+#define MSP_PORT_IO3    (0x01 << 3)
+#define MSP_PORT_IO4    (0x01 << 4)
+#define MSP_PORT_IO5    (0x01 << 5)
+#define MSP_PORT_IO6    (0x01 << 6)
+#define MSP_PORT_IO7    (0x01 << 7)
+
+//*****************************************************************************
+//
+// MSP port ID are defined here, use these to select desired port for gpio 
+// functions.
+//
+//*****************************************************************************
+
+#define MSP_PORT1    1
+#define MSP_PORT2    2
+#define MSP_PORT3    3
+#define MSP_PORT4    4
+#define MSP_PORT5    5
+#define MSP_PORT6    6
+#define MSP_PORT7    7
+#define MSP_PORT8    8
+
+//*****************************************************************************
+//
+// Generic pin ID defined here, use these to configure the indivdual pin
+// settings.
+//
+//*****************************************************************************
+
+#define GPIO_IOID0		0
+#define GPIO_IOID1		1
+#define GPIO_IOID2		2
+#define GPIO_IOID3		3
+#define GPIO_IOID4		4
+#define GPIO_IOID5		5
+#define GPIO_IOID6		6
+#define GPIO_IOID7		7
+#define GPIO_IOID8		8
+#define GPIO_IOID9		9
+#define GPIO_IOID10		10
+#define GPIO_IOID11		11
+#define GPIO_IOID12		12
+#define GPIO_IOID13		13
+
+#ifdef __MSP430_HAS_PORT3_R__
+  	#ifdef __MSP430_HAS_PORT3__
+    	#error "gpio.h: GPIO_IOID for port 3 and above not defined yet!"
+  	#endif
+#endif
+
+//*****************************************************************************
+//
+// Port base addresses resolved at compile time, 0xFFFF for ports which are
+// not available on the device.
+//
+//*****************************************************************************
+
+#if defined(__MSP430_HAS_PORT1_R__)
+#define GPIO_PORT1_BASE		MSP430_PORT1_ADDR
+#else
+#define GPIO_PORT1_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT2_R__)
+#define GPIO_PORT2_BASE		MSP430_PORT2_ADDR
+#else
+#define GPIO_PORT2_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT3_R__)
+#define GPIO_PORT3_BASE		MSP430_PORT3_ADDR
+#else
+#define GPIO_PORT3_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT4_R__)
+#define GPIO_PORT4_BASE		MSP430_PORT4_ADDR
+#else
+#define GPIO_PORT4_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT5_R__)
+#define GPIO_PORT5_BASE		MSP430_PORT5_ADDR
+#else
+#define GPIO_PORT5_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT6_R__)
+#define GPIO_PORT6_BASE		MSP430_PORT6_ADDR
+#else
+#define GPIO_PORT6_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT7_R__)
+#define GPIO_PORT7_BASE		MSP430_PORT7_ADDR
+#else
+#define GPIO_PORT7_BASE		0xFFFF
+#endif
+#if defined(__MSP430_HAS_PORT8_R__)
+#define GPIO_PORT8_BASE		MSP430_PORT8_ADDR
+#else
+#define GPIO_PORT8_BASE		0xFFFF
+#endif
+
+#define GPIO_PORT_BASE(port)	(((port) == MSP_PORT1) ? GPIO_PORT1_BASE : \
+								 ((port) == MSP_PORT2) ? GPIO_PORT2_BASE : \
+								 ((port) == MSP_PORT3) ? GPIO_PORT3_BASE : \
+								 ((port) == MSP_PORT4) ? GPIO_PORT4_BASE : \
+								 ((port) == MSP_PORT5) ? GPIO_PORT5_BASE : \
+								 ((port) == MSP_PORT6) ? GPIO_PORT6_BASE : \
+								 ((port) == MSP_PORT7) ? GPIO_PORT7_BASE : \
+								 ((port) == MSP_PORT8) ? GPIO_PORT8_BASE : 0xFFFF)
+
+//Generic pin ID decoding, shifts and masks only as MAX_NUM_PIN is 8
+#define GPIO_PIN_TO_PORT(gpio_pin_id)	(((gpio_pin_id) >> 3) + 1)
+#define GPIO_PIN_TO_BIT(gpio_pin_id)	((gpio_pin_id) & 0x07)
+#define GPIO_PIN_TO_MASK(gpio_pin_id)	(1 << GPIO_PIN_TO_BIT(gpio_pin_id))
+
+#if (MAX_NUM_PIN != 8)
+	#error "gpio.h: Pin ID decoding assumes 8 pins per port!"
+#endif
+
+//*****************************************************************************
+//
+// GPIO interrupt flag identifier
+//
+//*****************************************************************************
+
+#define GPIO_IFG0      (0x01)
+#define GPIO_IFG1      (0x01 << 1)
+#define GPIO_IFG2      (0x01 << 2)
+#define GPIO_IFG3      (0x01 << 3)
+#define GPIO_IFG4      (0x01 << 4)
+#define GPIO_IFG5      (0x01 << 5)
+#define GPIO_IFG6      (0x01 << 6)
+#define GPIO_IFG7      (0x01 << 7)
+
+
+typedef struct {
+	uint8_t port;
+  	uint8_t pin;
+} Port_t;
+
+//Pin interrupt callback, called from the port interrupt handler with the pin ID
+typedef void (*GPIO_Callback_t)(uint8_t gpio_pin_id);
+
+//Pin handle, resolved at compile time when created from a constant pin ID
+typedef struct {
+	uint16_t base_address;	//Port register base address
+	uint8_t pin_mask;		//Pin bit mask within the port
+} GPIO_Pin_t;
+
+#define GPIO_PIN(gpio_pin_id)	((GPIO_Pin_t){GPIO_PORT_BASE(GPIO_PIN_TO_PORT(gpio_pin_id)), GPIO_PIN_TO_MASK(gpio_pin_id)})
+
+//Timestamped pin edge
+typedef struct {
+	uint16_t timestamp;		//Timer A count when the port interrupt was serviced, in SMCLK cycles
+	uint8_t pin;			//Pin number within the port, 0 to 7
+	uint8_t falling;		//Non zero for a falling edge, from the edge select
+} GPIO_Edge_t;
+
+//Whole port configuration entry, applies a configuration to all masked pins
+typedef struct {
+	uint8_t port;			//MSP port ID
+	uint8_t pin_mask;		//MSP pin ID mask, MSP_PORT_IO0 to MSP_PORT_IO7
+	uint8_t gpio_config;	//GPIO configuration setting
+} GPIO_PortConfig_t;
+
+//*****************************************************************************
+//
+// Function prototype defined here
+// 
+//*****************************************************************************
+
+static void setOutputPin(uint8_t port, uint8_t pin);
+static void setInputPin(uint8_t port, uint8_t pin);
+static inline void setPinPull(uint8_t port, uint8_t pin, uint8_t gpio_config);
+void GPIO_reset(void);
+void GPIO_configurePin(uint8_t gpio_pin_id, uint8_t gpio_config);
+void GPIO_pinWrite(uint8_t gpio_pin_id, uint8_t output_value);
+uint8_t GPIO_pinRead(uint8_t gpio_pin_id);
+#if (GPIO_NUM_CALLBACK_PINS > 0)
+void GPIO_registerCallback(uint8_t gpio_pin_id, GPIO_Callback_t callback);
+#endif
+#if (GPIO_TIMESTAMP_BUFFER_SIZE > 0)
+void GPIO_timestampEnable(uint8_t port, uint8_t pin_mask);
+uint8_t GPIO_readEdges(uint8_t port, GPIO_Edge_t *edge_buffer, uint8_t max_edges);
+#endif
+void GPIO_configurePort(const GPIO_PortConfig_t *config_table, uint8_t num_entries);
+void GPIO_portWrite(uint8_t port, uint8_t pin_mask, uint8_t value);
+void GPIO_portSet(uint8_t port, uint8_t pin_mask);
+void GPIO_portClear(uint8_t port, uint8_t pin_mask);
+void GPIO_portToggle(uint8_t port, uint8_t pin_mask);
+uint8_t GPIO_portRead(uint8_t port);
+void GPIO_Port1_Event_Handler(void);
+void GPIO_Port2_Event_Handler(void);
+
+//*****************************************************************************
+//
+// Pin handle access functions defined here. These are inline so a handle
+// built from a constant pin ID, e.g. #define LED_PIN GPIO_PIN(GPIO_IOID5),
+// folds down to a single bit set/clear/test instruction on the port register.
+// 
+//*****************************************************************************
+
+static inline void GPIO_write(GPIO_Pin_t pin, uint8_t output_value)
+{
+	if(output_value == LOGIC_HIGH)
+	{
+		HWREG8(pin.base_address + OFS_POUT) |= pin.pin_mask;
+	}
+	else
+	{
+		HWREG8(pin.base_address + OFS_POUT) &= ~pin.pin_mask;
+	}
+}
+
+static inline void GPIO_set(GPIO_Pin_t pin)
+{
+	HWREG8(pin.base_address + OFS_POUT) |= pin.pin_mask;
+}
+
+static inline void GPIO_clear(GPIO_Pin_t pin)
+{
+	HWREG8(pin.base_address + OFS_POUT) &= ~pin.pin_mask;
+}
+
+static inline void GPIO_toggle(GPIO_Pin_t pin)
+{
+	HWREG8(pin.base_address + OFS_POUT) ^= pin.pin_mask;
+}
+
+static inline uint8_t GPIO_read(GPIO_Pin_t pin)
+{
+	return HWREG8(pin.base_address + OFS_PIN) & pin.pin_mask;
+}
+
+#endif  //_GPIO_H_
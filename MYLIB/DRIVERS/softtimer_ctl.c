@@ -0,0 +1,854 @@
+// *****************************************************************************
+// *  File: softtimer_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the software timer service.
+// *  Timer A CC0 generates the 1ms base tick, the 10ms, 100ms and 1s
+// *  resolutions are ticked from a chain of prescaler counters so all of the
+// *  soft timers share one compare channel and one interrupt.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "softtimer_ctl.h"
+#include "interrupt.h"
+
+// Private variables defined here
+static TWHEEL__Timer_t SoftTimer[SOFTTMR__NUM_SOFT_TIMERS];
+static TWHEEL__Wheel_t SoftTimerWheel[SOFTTMR__NUM_RESOLUTIONS];
+static uint8_t SoftTimerBuckets[SOFTTMR__NUM_WHEEL_BUCKETS];    //Bucket heads of all wheels
+static uint8_t Prescaler[SOFTTMR__NUM_RESOLUTIONS];   //Ticks of the previous resolution left until the next tick
+static uint8_t TickMode;
+static uint16_t TickBaseCount;      //Timer count matching the current base tick
+static uint16_t TicksProgrammed;    //Base ticks between the current tick and the programmed compare
+static uint16_t MissedTicks;        //Base ticks serviced late, wraps around
+static uint16_t CompareValue;       //Whole timer counts per base tick at the current timer clock
+static uint16_t CompareFraction;    //Remaining timer clock cycles per second not covered by CompareValue
+static uint16_t CompareMargin;      //SOFTTMR__COMPARE_MARGIN in timer counts
+static uint16_t TickFraction;       //Fractional count carried into the next compare interval, in the same units
+static uint16_t TicklessMaxTicks;   //Longest interval that fits the compare register in tickless mode
+
+//Callback timers, indexed the same as the soft timer storage
+static SOFTTMR__Callback_t SoftTimerCallback[SOFTTMR__NUM_SOFT_TIMERS];
+static uint16_t SoftTimerReload[SOFTTMR__NUM_SOFT_TIMERS];     //Zero for one shot timers
+
+//Single producer (timer interrupt) single consumer (main loop) callback queue
+static SOFTTMR__Callback_t CallbackQueue[SOFTTMR__CALLBACK_QUEUE_SIZE];
+static volatile uint8_t CallbackQueueHead;  //Only written by the timer interrupt
+static volatile uint8_t CallbackQueueTail;  //Only written by the main loop
+
+static const uint8_t NumSoftTimers[SOFTTMR__NUM_RESOLUTIONS] = {
+    SOFTTMR__NUM_1MS_TIMERS,
+    SOFTTMR__NUM_10MS_TIMERS,
+    SOFTTMR__NUM_100MS_TIMERS,
+    SOFTTMR__NUM_1S_TIMERS
+};
+
+static const uint8_t WheelLevels[SOFTTMR__NUM_RESOLUTIONS] = {
+    SOFTTMR__WHEEL_LEVELS_1MS,
+    SOFTTMR__WHEEL_LEVELS_10MS,
+    SOFTTMR__WHEEL_LEVELS_100MS,
+    SOFTTMR__WHEEL_LEVELS_1S
+};
+
+static const uint8_t PrescalerReload[SOFTTMR__NUM_RESOLUTIONS] = {
+    1,
+    SOFTTMR__DIVIDE_10MS,
+    SOFTTMR__DIVIDE_100MS,
+    SOFTTMR__DIVIDE_1S
+};
+
+static const uint8_t InvalidReadError[SOFTTMR__NUM_RESOLUTIONS] = {
+    SOFTTMR__INVALID_1MS_TIMER_READ,
+    SOFTTMR__INVALID_10MS_TIMER_READ,
+    SOFTTMR__INVALID_TIMER_READ,
+    SOFTTMR__INVALID_TIMER_READ
+};
+
+static const uint8_t InvalidWriteError[SOFTTMR__NUM_RESOLUTIONS] = {
+    SOFTTMR__INVALID_1MS_TIMER_WRITE,
+    SOFTTMR__INVALID_10MS_TIMER_WRITE,
+    SOFTTMR__INVALID_TIMER_WRITE,
+    SOFTTMR__INVALID_TIMER_WRITE
+};
+
+#if (SOFTTMR__NUM_SOFT_TIMERS < SOFTTMR__MAX_SOFT_TIMERS)
+
+//*****************************************************************************
+// Purpose: Timer wheel expiry handler. Auto reload timers are restarted from
+//          their expiry tick so the period does not drift, the callback is
+//          queued for the main loop.
+// Argument: wheel - Timer wheel of the expired timer
+//           timerId - Expired timer
+// Return: None
+//
+//*****************************************************************************
+
+static void TimerExpired(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    uint8_t index = (uint8_t)(wheel->timers - SoftTimer) + timerId;
+    uint8_t head;
+
+    if(SoftTimerReload[index] > 0)
+    {
+        TWHEEL__Start(wheel, timerId, SoftTimerReload[index]);
+    }
+
+    if(SoftTimerCallback[index] != 0)
+    {
+        head = (CallbackQueueHead + 1) & SOFTTMR__CALLBACK_QUEUE_MASK;
+
+        if(head != CallbackQueueTail)
+        {
+            CallbackQueue[CallbackQueueHead] = SoftTimerCallback[index];
+            CallbackQueueHead = head;   //Publish the entry after it is written
+        }
+        else
+        {
+            LIBUTIL__LogError(SOFTTMR__CALLBACK_QUEUE_OVERFLOW);
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Reset all software timers and the resolution prescaler chain
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void ResetSoftTimer(void)
+{
+    uint8_t resolution;
+    uint8_t index;
+    uint8_t offset = 0;
+    uint8_t bucket = 0;
+
+    for(resolution = 0; resolution < SOFTTMR__NUM_RESOLUTIONS; resolution++)
+    {
+        TWHEEL__Init(&SoftTimerWheel[resolution], &SoftTimer[offset], NumSoftTimers[resolution], &SoftTimerBuckets[bucket], WheelLevels[resolution], TimerExpired);
+        Prescaler[resolution] = PrescalerReload[resolution];
+        offset += NumSoftTimers[resolution];
+        bucket += TWHEEL__NUM_BUCKETS(WheelLevels[resolution]);
+    }
+
+    for(index = 0; index < SOFTTMR__NUM_SOFT_TIMERS; index++)
+    {
+        SoftTimerCallback[index] = 0;
+        SoftTimerReload[index] = 0;
+    }
+
+    CallbackQueueHead = 0;
+    CallbackQueueTail = 0;
+}
+
+//*****************************************************************************
+// Purpose: Warm start the timer peripheral
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StartTimer(void)
+{
+    HWREG16(TIMERA_TACTL_REG_ADDR) |= SOFTTMR__TIMER_MODE_CONFIG; //Put the timer into stop mode
+    INT__Enable(TIMERA_CC0_INT);
+    HW__RequestClocks(HW__CLOCK_USER_SOFTTMR, HW__CLOCK_TIMERA);
+}
+
+//*****************************************************************************
+// Purpose: Stop the timer peripheral
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StopTimer(void)
+{
+    INT__Disable(TIMERA_CC0_INT);
+    HWREG16(TIMERA_TACTL_REG_ADDR) &= ~(SOFTTMR__TIMER_MODE_CONFIG); //Put the timer into stop mode
+    HW__RequestClocks(HW__CLOCK_USER_SOFTTMR, HW__CLOCK_NONE);
+}
+
+//*****************************************************************************
+// Purpose: Determine the timer counts spanned by a number of base ticks from
+//          the current tick. A timer clock which is not a multiple of the tick
+//          rate, such as the 32768Hz ACLK, leaves a fraction of a count per
+//          tick which is carried from one interval to the next.
+// Argument: ticks - Number of base ticks
+// Return: Timer counts
+//
+//*****************************************************************************
+
+static uint16_t TickCounts(uint16_t ticks)
+{
+    uint16_t counts = ticks * CompareValue;
+
+    if(CompareFraction != 0)
+    {
+        counts += (uint16_t)((TickFraction + ((uint32_t)ticks * CompareFraction)) / SOFTTMR__TICK_RATE_HZ);
+    }
+
+    return counts;
+}
+
+//*****************************************************************************
+// Purpose: Determine the timer counts spanned by a number of base ticks and
+//          carry the fractional count on, once the ticks are committed to the
+//          compare chain.
+// Argument: ticks - Number of base ticks
+// Return: Timer counts
+//
+//*****************************************************************************
+
+static uint16_t CommitTicks(uint16_t ticks)
+{
+    uint16_t counts = TickCounts(ticks);
+
+    if(CompareFraction != 0)
+    {
+        TickFraction = (uint16_t)((TickFraction + ((uint32_t)ticks * CompareFraction)) % SOFTTMR__TICK_RATE_HZ);
+    }
+
+    return counts;
+}
+
+//*****************************************************************************
+// Purpose: Determine the number of whole base ticks in a timer count.
+// Argument: counts - Timer counts
+// Return: Number of base ticks
+//
+//*****************************************************************************
+
+static uint16_t CountsToTicks(uint16_t counts)
+{
+    uint32_t timer_hz;
+
+    if(CompareFraction == 0)
+    {
+        return (counts / CompareValue);
+    }
+
+    timer_hz = ((uint32_t)CompareValue * SOFTTMR__TICK_RATE_HZ) + CompareFraction;
+
+    return (uint16_t)(((uint32_t)counts * SOFTTMR__TICK_RATE_HZ) / timer_hz);
+}
+
+//*****************************************************************************
+// Purpose: Determine how many base ticks have passed since a tick, measured
+//          against the live timer count. A tick due within the compare margin
+//          is counted as passed, it would be missed by the compare write.
+//          Delays longer than the timer counter range can not be detected.
+// Argument: tickCount - Timer count of the last serviced tick
+// Return: Number of further ticks already due
+//
+//*****************************************************************************
+
+static inline uint16_t LateTicks(uint16_t tickCount)
+{
+    uint16_t elapsed = HWREG16(TIMERA_TAR_REG_ADDR) - tickCount + CompareMargin;
+    uint16_t late = 0;
+
+    if(elapsed >= CompareValue)
+    {
+        late = CountsToTicks(elapsed);
+
+        if(late > 0)
+        {
+            MissedTicks += late;
+            LIBUTIL__LogError(SOFTTMR__TICK_OVERRUN);
+        }
+    }
+
+    return late;
+}
+
+//*****************************************************************************
+// Purpose: Calculate timer compare value and set the counter. The next compare
+//          value follows on from the current one, any compare points the timer
+//          has already passed are skipped and returned as ticks to catch up.
+// Argument: None
+// Return: Number of base ticks to apply, one unless the interrupt was late
+//
+//*****************************************************************************
+
+static inline uint16_t SetCompareValue(void)
+{
+    uint16_t currentValue = HWREG16(TIMERA_TACCR0_REG_ADDR);
+    uint16_t ticks = 1 + LateTicks(currentValue);
+
+    //Counter wraps modulo 2^16, as does the compare register
+    HWREG16(TIMERA_TACCR0_REG_ADDR) = currentValue + CommitTicks(ticks);
+
+    return ticks;
+}
+
+//*****************************************************************************
+// Purpose: Advance the soft timers by a number of base ticks. Each resolution
+//          is only ticked when its prescaler counter runs out, so a periodic
+//          base tick normally only touches the 1ms wheel.
+// Argument: ticks - Number of base ticks elapsed
+// Return: None
+//
+//*****************************************************************************
+
+static void AdvanceTicks(uint16_t ticks)
+{
+    uint8_t resolution;
+    uint16_t resolutionTicks;
+
+    TWHEEL__Advance(&SoftTimerWheel[SOFTTMR__RES_1MS], ticks);
+
+    //Feed the ticks of each resolution into the prescaler of the next one
+    for(resolution = SOFTTMR__RES_1MS + 1; (resolution < SOFTTMR__NUM_RESOLUTIONS) && (ticks > 0); resolution++)
+    {
+        resolutionTicks = 0;
+
+        while(ticks >= Prescaler[resolution])
+        {
+            ticks -= Prescaler[resolution];
+            Prescaler[resolution] = PrescalerReload[resolution];
+            resolutionTicks++;
+        }
+
+        Prescaler[resolution] -= ticks;
+        TWHEEL__Advance(&SoftTimerWheel[resolution], resolutionTicks);
+        ticks = resolutionTicks;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Determine the number of base ticks until any resolution has a soft
+//          timer event due. The result is capped to the tickless maximum.
+// Argument: None
+// Return: Base ticks until the next event
+//
+//*****************************************************************************
+
+static uint16_t TicksToNextEvent(void)
+{
+    uint32_t nextEvent = TicklessMaxTicks;
+    uint32_t firstTick = 1;     //Base ticks until the next tick of the resolution
+    uint32_t period = 1;        //Base ticks per tick of the resolution
+    uint32_t eventTick;
+    uint16_t ticks;
+    uint8_t resolution;
+
+    for(resolution = 0; resolution < SOFTTMR__NUM_RESOLUTIONS; resolution++)
+    {
+        if(resolution > 0)
+        {
+            firstTick += (Prescaler[resolution] - 1) * period;
+            period *= PrescalerReload[resolution];
+        }
+
+        //Coarser resolutions can not tick any earlier
+        if(firstTick >= nextEvent)
+        {
+            break;
+        }
+
+        ticks = TWHEEL__TicksToNextEvent(&SoftTimerWheel[resolution]);
+
+        if(ticks != TWHEEL__NO_PENDING_EVENT)
+        {
+            eventTick = firstTick + ((ticks - 1) * period);
+
+            if(eventTick < nextEvent)
+            {
+                nextEvent = eventTick;
+            }
+        }
+    }
+
+    return (uint16_t)nextEvent;
+}
+
+//*****************************************************************************
+// Purpose: Apply a batch of late base ticks. The ticks are advanced in steps
+//          that stop at every soft timer event, so no expiry is skipped.
+// Argument: ticks - Number of base ticks elapsed
+// Return: None
+//
+//*****************************************************************************
+
+static void CatchUpLateTicks(uint16_t ticks)
+{
+    uint16_t step;
+
+    while(ticks > 0)
+    {
+        step = TicksToNextEvent();
+
+        if(step > ticks)
+        {
+            step = ticks;
+        }
+
+        AdvanceTicks(step);
+        ticks -= step;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Program the compare register for the next soft timer deadline when
+//          in tickless mode. The interval is capped by the timer counter range
+//          so an idle service still wakes up once per counter range. A
+//          deadline the timer has passed, or reaches within the compare
+//          margin, would only match a counter range later, the compare
+//          interrupt is raised at once instead and catches up the late ticks.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void SetNextDeadline(void)
+{
+    uint16_t counts;
+
+    TicksProgrammed = TicksToNextEvent();
+    counts = TickCounts(TicksProgrammed);
+    HWREG16(TIMERA_TACCR0_REG_ADDR) = TickBaseCount + counts;
+
+    if((uint16_t)(HWREG16(TIMERA_TAR_REG_ADDR) - TickBaseCount + CompareMargin) >= counts)
+    {
+        HWREG16(TIMERA_TACCTL0_REG_ADDR) |= TIMERA_CCIFG_MASK;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Account for the ticks which have elapsed since the last tickless
+//          wake up, so the wheels are current before timers are read or written.
+//          The programmed deadline itself is left to the interrupt handler.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void CatchUpTicks(void)
+{
+    uint16_t elapsed = CountsToTicks(HWREG16(TIMERA_TAR_REG_ADDR) - TickBaseCount);
+
+    if(elapsed >= TicksProgrammed)
+    {
+        elapsed = TicksProgrammed - 1;
+    }
+
+    //No timer can expire before the programmed deadline, apply the ticks in bulk
+    AdvanceTicks(elapsed);
+    TickBaseCount += CommitTicks(elapsed);
+    TicksProgrammed -= elapsed;
+}
+
+//*****************************************************************************
+// Purpose: Switch between periodic and tickless interrupt generation. The
+//          base tick is kept aligned with the compare chain across the switch.
+// Argument: tickMode - SOFTTMR__TICK_MODE_PERIODIC or SOFTTMR__TICK_MODE_TICKLESS
+// Return: None
+//
+//*****************************************************************************
+
+static void SetTickMode(uint8_t tickMode)
+{
+    if(tickMode == SOFTTMR__TICK_MODE_TICKLESS)
+    {
+        if(TickMode != SOFTTMR__TICK_MODE_TICKLESS)
+        {
+            //The last periodic tick happened one compare interval ago
+            TickBaseCount = HWREG16(TIMERA_TACCR0_REG_ADDR) - CompareValue;
+            TicksProgrammed = 1;
+            TickMode = SOFTTMR__TICK_MODE_TICKLESS;
+        }
+
+        SetNextDeadline();
+    }
+    else
+    {
+        if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+        {
+            CatchUpTicks();
+            HWREG16(TIMERA_TACCR0_REG_ADDR) = TickBaseCount + CommitTicks(1);
+        }
+
+        TickMode = SOFTTMR__TICK_MODE_PERIODIC;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Recalculate the compare interval for a new timer clock frequency.
+// Argument: timer_hz - Timer A clock frequency in Hz
+// Return: None
+//
+//*****************************************************************************
+
+static void SetCompareInterval(uint32_t timer_hz)
+{
+    CompareValue = (uint16_t)(timer_hz / SOFTTMR__TICK_RATE_HZ);
+    CompareFraction = (uint16_t)(timer_hz % SOFTTMR__TICK_RATE_HZ);
+    TickFraction = 0;
+    CompareMargin = (uint16_t)((((uint32_t)SOFTTMR__COMPARE_MARGIN * timer_hz) + HW__GetSmclkFrequency() - 1) / HW__GetSmclkFrequency());
+
+    //The carried fraction can add one count, keep clear of a full counter range
+    TicklessMaxTicks = CountsToTicks(0xFFFE);
+}
+
+//*****************************************************************************
+// Purpose: Clock change handler, called with interrupts disabled once the
+//          Timer A clock has changed. The part of the current tick already
+//          elapsed is rescaled to the new compare interval so the tick phase
+//          is kept, a compare which is already pending still lands in the
+//          past and is serviced as a late tick.
+// Argument: timer_hz - New Timer A clock frequency in Hz
+// Return: None
+//
+//*****************************************************************************
+
+static void ClockChanged(uint32_t timer_hz)
+{
+    uint16_t now = HWREG16(TIMERA_TAR_REG_ADDR);
+    uint32_t oldTimerHz = ((uint32_t)CompareValue * SOFTTMR__TICK_RATE_HZ) + CompareFraction;
+    uint16_t elapsed;
+
+    if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+    {
+        CatchUpTicks();
+    }
+    else
+    {
+        TickBaseCount = HWREG16(TIMERA_TACCR0_REG_ADDR) - CompareValue;
+    }
+
+    SetCompareInterval(timer_hz);
+
+    //Both clocks fit 16 bits once shifted, the product fits 32 bits for any
+    //elapsed count
+    elapsed = now - TickBaseCount;
+    TickBaseCount = now - (uint16_t)(((uint32_t)elapsed * (uint16_t)(timer_hz >> SOFTTMR__RESCALE_SHIFT)) /
+                                     (uint16_t)(oldTimerHz >> SOFTTMR__RESCALE_SHIFT));
+
+    //A single programmed tick may already be pending, only a longer tickless
+    //interval is safe to recalculate
+    if((TickMode == SOFTTMR__TICK_MODE_TICKLESS) && (TicksProgrammed > 1))
+    {
+        SetNextDeadline();
+    }
+    else
+    {
+        TicksProgrammed = 1;
+        HWREG16(TIMERA_TACCR0_REG_ADDR) = TickBaseCount + CommitTicks(1);
+    }
+}
+
+//*****************************************************************************
+// Purpose: This function resets and initiates timer to default configurations.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__Reset(void)
+{
+    //Reset and configure the Timer A peripheral to continuous compare mode
+    //Timer A peripheral configuration done else where in hardware initialisation
+    //HWREG16(TIMERA_TACTL_REG_ADDR) = SOFTTMR__TACTL_STARTUP_CONFIG;
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) = SOFTTMR__TACCTL_STARTUP_CONFIG;
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) &= ~TIMERA_CCIFG_MASK;
+
+    //Load counter compare value to compare and generate interrupt
+    SetCompareInterval(HW__GetTimerClockFrequency());
+    HW__RegisterClockHandler(HW__CLOCK_USER_SOFTTMR, ClockChanged);
+    HW__RequestClocks(HW__CLOCK_USER_SOFTTMR, HW__CLOCK_TIMERA);
+    HWREG16(TIMERA_TACCR0_REG_ADDR) = CommitTicks(1);
+
+    //Initialise software timers
+    ResetSoftTimer();
+    MissedTicks = 0;
+
+    //First tick is one compare interval from the start of the counter
+    TickMode = SOFTTMR__TICK_MODE_PERIODIC;
+    TickBaseCount = 0;
+    TicksProgrammed = 1;
+    SetTickMode(SOFTTMR__TICK_MODE_STARTUP_CONFIG);
+
+    //Enable capture and compare interrupts
+    INT__Enable(TIMERA_CC0_INT);
+}
+
+//*****************************************************************************
+// Purpose: This function allows for basic control of the timer peripheral
+// Argument: timerInterfaceBuffer - [0] Control setting
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__Control(uint16_t *timerInterfaceBuffer)
+{
+    INT__Disable(TIMERA_CC0_INT);
+    switch(timerInterfaceBuffer[SOFTTMR__CONFIG_SETTING_IDX])
+    {
+        case SOFTTMR__TIMER_START:
+            StartTimer();
+            break;
+
+        case SOFTTMR__TIMER_STOP:
+            StopTimer();
+            break;
+
+        case SOFTTMR__TICK_MODE_PERIODIC:
+        case SOFTTMR__TICK_MODE_TICKLESS:
+            SetTickMode(timerInterfaceBuffer[SOFTTMR__CONFIG_SETTING_IDX]);
+            break;
+
+        default:
+            LIBUTIL__LogError(SOFTTMR__INVALID_CONTROL_SETTING);
+    }
+    INT__Enable(TIMERA_CC0_INT);
+}
+
+//*****************************************************************************
+// Purpose: Perform a read of the specified software timer and return its
+//          value in the interface buffer.
+// Argument: resolution - Resolution the soft timer is registered under
+//           timerInterfaceBuffer - [0] Soft timer ID
+//                                  [1] Soft timer counter value (return)
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__Read(uint8_t resolution, uint16_t *timerInterfaceBuffer)
+{
+    if(resolution >= SOFTTMR__NUM_RESOLUTIONS)
+    {
+        LIBUTIL__LogError(SOFTTMR__INVALID_RESOLUTION);
+    }
+    else if(timerInterfaceBuffer[SOFTTMR__TIMER_ID_IDX] < NumSoftTimers[resolution])
+    {
+        INT__Disable(TIMERA_CC0_INT);
+
+        if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+        {
+            CatchUpTicks();
+        }
+
+        timerInterfaceBuffer[SOFTTMR__TIMER_COUNTER] = TWHEEL__Remaining(&SoftTimerWheel[resolution], timerInterfaceBuffer[SOFTTMR__TIMER_ID_IDX]);
+        INT__Enable(TIMERA_CC0_INT);
+    }
+    else
+    {
+        LIBUTIL__LogError(InvalidReadError[resolution]);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Software timers can be registered via calling this function,
+//          a unique timer
+// Argument: resolution - Resolution the soft timer is registered under
+//           timerInterfaceBuffer - [0] Soft timer ID
+//                                  [1] Soft timer counter value (write)
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__Write(uint8_t resolution, uint16_t *timerInterfaceBuffer)
+{
+    if(resolution >= SOFTTMR__NUM_RESOLUTIONS)
+    {
+        LIBUTIL__LogError(SOFTTMR__INVALID_RESOLUTION);
+    }
+    else if(timerInterfaceBuffer[SOFTTMR__TIMER_ID_IDX] < NumSoftTimers[resolution])
+    {
+        //Timer is moved to the wheel bucket matching its new expiry
+        INT__Disable(TIMERA_CC0_INT);
+        if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+        {
+            CatchUpTicks();
+            TWHEEL__Start(&SoftTimerWheel[resolution], timerInterfaceBuffer[SOFTTMR__TIMER_ID_IDX], timerInterfaceBuffer[SOFTTMR__TIMER_COUNTER]);
+            SetNextDeadline();  //New timer may be due before the programmed deadline
+        }
+        else
+        {
+            TWHEEL__Start(&SoftTimerWheel[resolution], timerInterfaceBuffer[SOFTTMR__TIMER_ID_IDX], timerInterfaceBuffer[SOFTTMR__TIMER_COUNTER]);
+        }
+        INT__Enable(TIMERA_CC0_INT);
+    }
+    else
+    {
+        LIBUTIL__LogError(InvalidWriteError[resolution]);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Register a callback against a soft timer and start it. On expiry
+//          the callback is queued for SOFTTMR__ProcessCallbacks, auto reload
+//          timers are restarted with the same period. Writing a zero count to
+//          the timer stops it.
+// Argument: resolution - Resolution the soft timer is registered under
+//           timerId - Soft timer ID
+//           callback - Function queued on expiry
+//           period - Timer period in ticks of the resolution
+//           reloadMode - SOFTTMR__ONE_SHOT or SOFTTMR__AUTO_RELOAD
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__RegisterCallback(uint8_t resolution, uint8_t timerId, SOFTTMR__Callback_t callback, uint16_t period, uint8_t reloadMode)
+{
+    uint8_t index;
+
+    if(resolution >= SOFTTMR__NUM_RESOLUTIONS)
+    {
+        LIBUTIL__LogError(SOFTTMR__INVALID_RESOLUTION);
+    }
+    else if(timerId < NumSoftTimers[resolution])
+    {
+        index = (uint8_t)(SoftTimerWheel[resolution].timers - SoftTimer) + timerId;
+
+        INT__Disable(TIMERA_CC0_INT);
+        SoftTimerCallback[index] = callback;
+        SoftTimerReload[index] = (reloadMode == SOFTTMR__AUTO_RELOAD) ? period : 0;
+
+        if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+        {
+            CatchUpTicks();
+            TWHEEL__Start(&SoftTimerWheel[resolution], timerId, period);
+            SetNextDeadline();
+        }
+        else
+        {
+            TWHEEL__Start(&SoftTimerWheel[resolution], timerId, period);
+        }
+        INT__Enable(TIMERA_CC0_INT);
+    }
+    else
+    {
+        LIBUTIL__LogError(InvalidWriteError[resolution]);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Read the number of base ticks the timer interrupt has serviced
+//          late. Late ticks are caught up so the soft timers stay on time, a
+//          growing count means the interrupt is held off for too long.
+// Argument: None
+// Return: Missed base tick count since reset, wraps around
+//
+//*****************************************************************************
+
+uint16_t SOFTTMR__MissedTicks(void)
+{
+    return MissedTicks;
+}
+
+//*****************************************************************************
+// Purpose: Read the timer compare interval of the base tick, follows the
+//          SMCLK frequency.
+// Argument: None
+// Return: Timer counts per base tick
+//
+//*****************************************************************************
+
+uint16_t SOFTTMR__CompareValue(void)
+{
+    return CompareValue;
+}
+
+//*****************************************************************************
+// Purpose: Check if any expired timer callbacks are waiting to be run.
+// Argument: None
+// Return: true if callbacks are queued
+//
+//*****************************************************************************
+
+bool SOFTTMR__CallbackPending(void)
+{
+    return (CallbackQueueHead != CallbackQueueTail);
+}
+
+//*****************************************************************************
+// Purpose: Run all queued expired timer callbacks, to be called from the main
+//          loop. The queue is lock free so interrupts stay enabled.
+// Argument: None
+// Return: Number of callbacks run
+//
+//*****************************************************************************
+
+uint8_t SOFTTMR__ProcessCallbacks(void)
+{
+    SOFTTMR__Callback_t callback;
+    uint8_t processed = 0;
+
+    while(CallbackQueueTail != CallbackQueueHead)
+    {
+        callback = CallbackQueue[CallbackQueueTail];
+        CallbackQueueTail = (CallbackQueueTail + 1) & SOFTTMR__CALLBACK_QUEUE_MASK;
+        callback();
+        processed++;
+    }
+
+    return processed;
+}
+
+//*****************************************************************************
+// Purpose: This is the soft timer service interrupt event handler, called on
+//          the Timer A CC0 compare interrupt.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SOFTTMR__EventHandler(void)
+{
+    uint16_t ticks;
+
+    //Cleared first, a deadline found to be already due sets it again
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) &= ~TIMERA_CCIFG_MASK; //Clear capture compare flag
+
+    if(TickMode == SOFTTMR__TICK_MODE_TICKLESS)
+    {
+        //Account for all ticks skipped since the last wake up, then sleep
+        //until the next soft timer deadline
+        AdvanceTicks(TicksProgrammed);
+        TickBaseCount += CommitTicks(TicksProgrammed);
+
+        //A late wake up must not program a deadline the timer has passed
+        ticks = LateTicks(TickBaseCount);
+
+        if(ticks > 0)
+        {
+            CatchUpLateTicks(ticks);
+            TickBaseCount += CommitTicks(ticks);
+        }
+
+        SetNextDeadline();
+    }
+    else
+    {
+        ticks = SetCompareValue();
+
+        //Periodic task calls to be added here
+
+        //Advance the timer wheels, only timers expiring on this tick are touched
+        if(ticks == 1)
+        {
+            AdvanceTicks(1);
+        }
+        else
+        {
+            CatchUpLateTicks(ticks);
+        }
+    }
+}
+
+#else
+    #error "softtimer_ctl.c: Max number of soft timers exceeded!"
+#endif //
+
+#if ((SOFTTMR__WHEEL_LEVELS_1MS < TWHEEL__MIN_LEVELS) || (SOFTTMR__WHEEL_LEVELS_10MS < TWHEEL__MIN_LEVELS) || \
+     (SOFTTMR__WHEEL_LEVELS_100MS < TWHEEL__MIN_LEVELS) || (SOFTTMR__WHEEL_LEVELS_1S < TWHEEL__MIN_LEVELS))
+    #error "softtimer_ctl.c: Soft timer wheels need at least TWHEEL__MIN_LEVELS levels!"
+#endif
@@ -0,0 +1,195 @@
+// *****************************************************************************
+// *  File: softtimer_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the software timer service. A single Timer A
+// *  capture/compare channel (CC0) generates the base tick, coarser resolutions
+// *  are derived from it through a chain of prescaler counters. All constants
+// *  and software timer registrations defined here.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _SOFTTIMER_CTL_H_
+#define _SOFTTIMER_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "libUtility.h"
+#include "timerwheel.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_SOFTTMR_CTL
+
+//*****************************************************************************
+//
+// Timer resolutions defined here, each resolution is derived from the one
+// before it.
+//
+//*****************************************************************************
+
+enum
+{
+    SOFTTMR__RES_1MS = 0,
+    SOFTTMR__RES_10MS,
+    SOFTTMR__RES_100MS,
+    SOFTTMR__RES_1S,
+    SOFTTMR__NUM_RESOLUTIONS
+};
+
+//Number of ticks of the previous resolution per tick of each resolution
+#define SOFTTMR__DIVIDE_10MS                10
+#define SOFTTMR__DIVIDE_100MS               10
+#define SOFTTMR__DIVIDE_1S                  10
+
+//Timer wheel levels of each resolution, each level costs TWHEEL__NUM_SLOTS
+//bytes of RAM. A timer longer than 4^levels ticks is cascaded once more on
+//every 4^levels ticks, which in tickless mode is an extra wake up.
+#define SOFTTMR__WHEEL_LEVELS_1MS           4   //256ms before a timer is cascaded again
+#define SOFTTMR__WHEEL_LEVELS_10MS          2   //160ms
+#define SOFTTMR__WHEEL_LEVELS_100MS         2   //1.6s
+#define SOFTTMR__WHEEL_LEVELS_1S            2   //16s
+
+#define SOFTTMR__NUM_WHEEL_BUCKETS          TWHEEL__NUM_BUCKETS(SOFTTMR__WHEEL_LEVELS_1MS + SOFTTMR__WHEEL_LEVELS_10MS + \
+                                                                SOFTTMR__WHEEL_LEVELS_100MS + SOFTTMR__WHEEL_LEVELS_1S)
+
+//*****************************************************************************
+//
+// Software timers defined and registered here, one list per resolution
+//
+//*****************************************************************************
+
+enum
+{
+    LED_SOFT_TIMER_2 = 0,
+    SOFTTMR__NUM_1MS_TIMERS
+};
+
+enum
+{
+    LED_SOFT_TIMER = 0,
+    DEBOUNCE_SOFT_TIMER,
+    SOFTTMR__NUM_10MS_TIMERS
+};
+
+enum
+{
+    WATCHDOG_SOFT_TIMER = 0,
+    SOFTTMR__NUM_100MS_TIMERS
+};
+
+enum
+{
+    DCOCAL_SOFT_TIMER = 0,
+    CRYSTAL_SOFT_TIMER,
+    SOFTTMR__NUM_1S_TIMERS
+};
+
+#define SOFTTMR__NUM_SOFT_TIMERS            (SOFTTMR__NUM_1MS_TIMERS + SOFTTMR__NUM_10MS_TIMERS + \
+                                             SOFTTMR__NUM_100MS_TIMERS + SOFTTMR__NUM_1S_TIMERS)
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+#define SOFTTMR__TIMER_CLOCK_SOURCE_CONFIG    TIMERA_SOURCE_SMCLK
+#define SOFTTMR__TIMER_CLOCK_DIVISION_CONFIG  TIMERA_DIVIDE_1
+#define SOFTTMR__TIMER_MODE_CONFIG            TIMERA_MODE_CONTINUOUS
+
+//Driver configuration preload values, configure for timer compare mode
+#define SOFTTMR__TACTL_STARTUP_CONFIG   (SOFTTMR__TIMER_CLOCK_SOURCE_CONFIG + SOFTTMR__TIMER_CLOCK_DIVISION_CONFIG + SOFTTMR__TIMER_MODE_CONFIG + TIMERA_TACLR_MASK)
+#define SOFTTMR__TACCTL_STARTUP_CONFIG  0x0000 //Configure with register default value
+
+//Base tick rate, the timer compare interval is recalculated from the SMCLK
+//frequency whenever the DCO frequency is changed
+#define SOFTTMR__TICK_RATE_HZ               1000
+
+//CPU cycles needed to write the compare register before the timer reaches
+//it, a tick due any sooner is treated as already missed. Converted to timer
+//counts for the current timer clock
+#define SOFTTMR__COMPARE_MARGIN             32
+
+//Timer clock frequencies are shifted down to 16 bits to rescale the part
+//of a tick elapsed on a clock change in 32 bit arithmetic. Exact for the
+//32768Hz ACLK, within 0.01% for DCO clocks of 1MHz and above
+#define SOFTTMR__RESCALE_SHIFT              8
+
+//Tick mode selected on driver reset
+#define SOFTTMR__TICK_MODE_STARTUP_CONFIG   SOFTTMR__TICK_MODE_PERIODIC
+
+#define SOFTTMR__MAX_SOFT_TIMERS            TWHEEL__MAX_TIMERS
+
+//Number of expired timer callbacks that can be queued for the main loop, power of 2
+#define SOFTTMR__CALLBACK_QUEUE_SIZE        8
+#define SOFTTMR__CALLBACK_QUEUE_MASK        (SOFTTMR__CALLBACK_QUEUE_SIZE - 1)
+
+//Callback timer reload modes
+#define SOFTTMR__ONE_SHOT                   0
+#define SOFTTMR__AUTO_RELOAD                1
+
+//Timer config type values
+#define SOFTTMR__TIMER_START                0
+#define SOFTTMR__TIMER_STOP                 1
+#define SOFTTMR__TICK_MODE_PERIODIC         2   //Interrupt on every base tick
+#define SOFTTMR__TICK_MODE_TICKLESS         3   //Interrupt on the next soft timer deadline only
+
+//Timer config buffer indexes
+#define SOFTTMR__CONFIG_SETTING_IDX         0
+#define SOFTTMR__CONFIG_BUFFER_SIZE         1
+
+//Timer read and write buffer indexes
+#define SOFTTMR__TIMER_ID_IDX               0
+#define SOFTTMR__TIMER_COUNTER              1
+#define SOFTTMR__RW_BUFFER_SIZE             2
+
+#define SOFTTMR__INTERFACE_BUFFER_SIZE      3
+
+//The 1ms and 10ms resolutions log the error codes of the one and ten
+//millisecond drivers they replace, the control setting is shared and keeps
+//the one millisecond driver code
+#define SOFTTMR__INVALID_1MS_TIMER_READ     31
+#define SOFTTMR__INVALID_1MS_TIMER_WRITE    32
+#define SOFTTMR__INVALID_10MS_TIMER_READ    11
+#define SOFTTMR__INVALID_10MS_TIMER_WRITE   12
+#define SOFTTMR__INVALID_CONTROL_SETTING    33
+#define SOFTTMR__INVALID_TIMER_READ         41
+#define SOFTTMR__INVALID_TIMER_WRITE        42
+#define SOFTTMR__INVALID_RESOLUTION         44
+#define SOFTTMR__CALLBACK_QUEUE_OVERFLOW    45
+#define SOFTTMR__TICK_OVERRUN               46
+
+//*****************************************************************************
+//
+// Soft timer service data types defined here
+//
+//*****************************************************************************
+
+//Expired timer callback, run from the main loop and not from interrupt context
+typedef void (*SOFTTMR__Callback_t)(void);
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void SOFTTMR__Reset(void);
+void SOFTTMR__Control(uint16_t *timerInterfaceBuffer);
+void SOFTTMR__Read(uint8_t resolution, uint16_t *timerInterfaceBuffer);
+void SOFTTMR__Write(uint8_t resolution, uint16_t *timerInterfaceBuffer);
+void SOFTTMR__RegisterCallback(uint8_t resolution, uint8_t timerId, SOFTTMR__Callback_t callback, uint16_t period, uint8_t reloadMode);
+bool SOFTTMR__CallbackPending(void);
+uint8_t SOFTTMR__ProcessCallbacks(void);
+uint16_t SOFTTMR__MissedTicks(void);
+uint16_t SOFTTMR__CompareValue(void);
+void SOFTTMR__EventHandler(void);
+
+#endif //_SOFTTIMER_CTL_H_
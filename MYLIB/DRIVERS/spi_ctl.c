@@ -0,0 +1,235 @@
+// *****************************************************************************
+// *  File: spi_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the USI SPI master driver.
+// *  Queued transfers form a linked list through their descriptors, so the
+// *  queue takes no RAM of its own. The head of the queue is the transfer on
+// *  the bus, the USI counter interrupt moves it on byte by byte and starts
+// *  the next transfer as soon as one completes.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "spi_ctl.h"
+
+// Private variables defined here
+static SPI__Transfer_t *Head;               //Transfer on the bus
+static SPI__Transfer_t *Tail;               //Last queued transfer
+static uint16_t Index;                      //Byte of the head transfer being shifted
+static GPIO_Pin_t HeldSelect;               //Chip select left low by a keep_selected transfer
+static bool Holding;
+
+//*****************************************************************************
+// Purpose: Clocks the USI needs kept running while transfers are queued.
+// Argument: None
+// Return: HW__CLOCK_* flags
+//
+//*****************************************************************************
+
+static uint8_t SpiClocks(void)
+{
+    return (SPI__CLOCK_SOURCE == USI_SOURCE_ACLK) ? HW__CLOCK_ACLK : HW__CLOCK_SMCLK;
+}
+
+//*****************************************************************************
+// Purpose: Select the device of a transfer and start shifting its first byte.
+// Argument: transfer - Transfer to start
+// Return: None
+//
+//*****************************************************************************
+
+static void StartTransfer(SPI__Transfer_t *transfer)
+{
+    transfer->status = SPI__TRANSFER_ACTIVE;
+    Index = 0;
+
+    //A chip select held by the previous transfer is released unless this
+    //transfer goes to the same device
+    if(Holding)
+    {
+        if((HeldSelect.base_address != transfer->chip_select.base_address) || (HeldSelect.pin_mask != transfer->chip_select.pin_mask))
+        {
+            GPIO_set(HeldSelect);
+        }
+
+        Holding = false;
+    }
+
+    GPIO_clear(transfer->chip_select);
+
+    HWREG8(USI_SRL_REG_ADDR) = (transfer->tx != 0) ? transfer->tx[0] : SPI__FILL_BYTE;
+
+    //Writing the bit counter clears the interrupt flag and starts the clock
+    HWREG8(USI_CNT_REG_ADDR) = 8;
+}
+
+//*****************************************************************************
+// Purpose: Reset the USI as an SPI master on P1.5 to P1.7 with an empty
+//          queue. Queued transfers are dropped without their callbacks.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SPI__Reset(void)
+{
+    SPI__Transfer_t *transfer;
+    uint16_t state;
+
+    state = INT__EnterCritical();
+
+    INT__Disable(USI_INT);
+    HWREG8(USI_CTL0_REG_ADDR) = USI_SOFTWARE_RESET;
+
+    if(Head != 0)
+    {
+        GPIO_set(Head->chip_select);
+    }
+
+    if(Holding)
+    {
+        GPIO_set(HeldSelect);
+        Holding = false;
+    }
+
+    for(transfer = Head; transfer != 0; transfer = transfer->next)
+    {
+        transfer->status = SPI__TRANSFER_DONE;
+    }
+
+    Head = 0;
+    Tail = 0;
+
+    //Mode 0 and 2 capture on the first clock edge
+    HWREG8(USI_CTL0_REG_ADDR) = USI_PORT_SCLK + USI_PORT_SDO + USI_PORT_SDI + USI_MASTER + USI_OUTPUT_ENABLE + USI_SOFTWARE_RESET;
+    HWREG8(USI_CTL1_REG_ADDR) = (SPI__MODE & 1) ? 0 : USI_CLOCK_PHASE;
+    HWREG8(USI_CKCTL_REG_ADDR) = SPI__CLOCK_DIVIDE + SPI__CLOCK_SOURCE + ((SPI__MODE & 2) ? USI_CLOCK_POLARITY : 0);
+    HWREG8(USI_CTL0_REG_ADDR) &= ~USI_SOFTWARE_RESET;
+
+    HW__RequestClocks(HW__CLOCK_USER_SPI, HW__CLOCK_NONE);
+    INT__Enable(USI_INT);
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Queue a transfer, it is started at once when the bus is idle.
+// Argument: transfer - Transfer descriptor, must stay valid until done
+// Return: True if the transfer has been queued
+//
+//*****************************************************************************
+
+bool SPI__Queue(SPI__Transfer_t *transfer)
+{
+    uint16_t state;
+
+    if((transfer->length == 0) || (transfer->status != SPI__TRANSFER_DONE))
+    {
+        LIBUTIL__LogError(SPI__INVALID_TRANSFER);
+        return false;
+    }
+
+    transfer->next = 0;
+    transfer->status = SPI__TRANSFER_QUEUED;
+
+    state = INT__EnterCritical();
+
+    if(Head == 0)
+    {
+        Head = transfer;
+        Tail = transfer;
+
+        HW__RequestClocks(HW__CLOCK_USER_SPI, SpiClocks());
+        StartTransfer(transfer);
+    }
+    else
+    {
+        Tail->next = transfer;
+        Tail = transfer;
+    }
+
+    INT__ExitCritical(state);
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Check whether transfers are queued or on the bus.
+// Argument: None
+// Return: True if the bus is busy
+//
+//*****************************************************************************
+
+bool SPI__IsBusy(void)
+{
+    return (Head != 0);
+}
+
+//*****************************************************************************
+// Purpose: USI counter interrupt handler, called once a byte has been
+//          shifted. The received byte is stored and the next byte loaded, a
+//          completed transfer releases its chip select and the next queued
+//          transfer is started before the completion callback is called.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SPI__TransferHandler(void)
+{
+    SPI__Transfer_t *transfer = Head;
+    uint8_t received = HWREG8(USI_SRL_REG_ADDR);
+
+    if(transfer == 0)
+    {
+        HWREG8(USI_CTL1_REG_ADDR) &= ~USI_IFG_MASK;
+        return;
+    }
+
+    if(transfer->rx != 0)
+    {
+        transfer->rx[Index] = received;
+    }
+
+    if(++Index < transfer->length)
+    {
+        HWREG8(USI_SRL_REG_ADDR) = (transfer->tx != 0) ? transfer->tx[Index] : SPI__FILL_BYTE;
+        HWREG8(USI_CNT_REG_ADDR) = 8;
+        return;
+    }
+
+    Holding = transfer->keep_selected;
+
+    if(Holding)
+    {
+        HeldSelect = transfer->chip_select;
+    }
+    else
+    {
+        GPIO_set(transfer->chip_select);
+    }
+
+    Head = transfer->next;
+    transfer->status = SPI__TRANSFER_DONE;
+
+    if(Head != 0)
+    {
+        StartTransfer(Head);
+    }
+    else
+    {
+        HWREG8(USI_CTL1_REG_ADDR) &= ~USI_IFG_MASK;
+        HW__RequestClocks(HW__CLOCK_USER_SPI, HW__CLOCK_NONE);
+    }
+
+    if(transfer->callback != 0)
+    {
+        transfer->callback(transfer);
+    }
+}
@@ -0,0 +1,99 @@
+// *****************************************************************************
+// *  File: spi_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the USI SPI master driver. Transfers are
+// *  described by caller owned descriptors and queued, the USI counter
+// *  interrupt shifts the bytes of a transfer and starts the next queued
+// *  transfer straight from the interrupt handler, so the bus keeps running
+// *  without waiting on the main loop.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _SPI_CTL_H_
+#define _SPI_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "gpio.h"
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_SPI_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//SPI modes, clock polarity and phase
+#define SPI__MODE_0                         0   //Clock idles low, data captured on the rising edge
+#define SPI__MODE_1                         1   //Clock idles low, data captured on the falling edge
+#define SPI__MODE_2                         2   //Clock idles high, data captured on the falling edge
+#define SPI__MODE_3                         3   //Clock idles high, data captured on the rising edge
+
+//SPI clock, SMCLK divided by 2^n. Each byte costs one USI interrupt, the bus
+//idles between bytes for the interrupt handler time when the byte shifts out
+//faster than that. SMCLK is held on while transfers are queued.
+#define SPI__CLOCK_SOURCE                   USI_SOURCE_SMCLK
+#define SPI__CLOCK_DIVIDE                   USI_DIVIDE(0)
+#define SPI__MODE                           SPI__MODE_0
+
+//Byte sent by transfers without transmit data
+#define SPI__FILL_BYTE                      0xFF
+
+//Transfer status
+#define SPI__TRANSFER_DONE                  0   //Complete, or never queued
+#define SPI__TRANSFER_QUEUED                1
+#define SPI__TRANSFER_ACTIVE                2
+
+#define SPI__INVALID_TRANSFER               120
+
+//*****************************************************************************
+//
+// Driver data types defined here
+//
+//*****************************************************************************
+
+typedef struct SPI__Transfer SPI__Transfer_t;
+
+//Transfer complete callback, called from the USI interrupt handler once the
+//chip select has been released. The next queued transfer is already running,
+//the callback may queue further transfers, including this one again.
+//transfer - Completed transfer
+typedef void (*SPI__DoneCallback_t)(SPI__Transfer_t *transfer);
+
+//Transfer descriptor, owned by the caller and left untouched until the
+//transfer is done. The chip select pin must be configured as an output driven
+//high, it is driven low for the duration of the transfer.
+struct SPI__Transfer {
+    GPIO_Pin_t chip_select;                 //Active low chip select, see GPIO_PIN
+    const uint8_t *tx;                      //Bytes to send, 0 to send SPI__FILL_BYTE
+    uint8_t *rx;                            //Bytes received, 0 to discard, may be the tx buffer
+    uint16_t length;                        //Number of bytes, at least 1
+    bool keep_selected;                     //Leave the chip select low until the next transfer, released first if that one selects another device
+    SPI__DoneCallback_t callback;           //Called once done, 0 for none
+    SPI__Transfer_t *next;                  //Queue link, used by the driver
+    volatile uint8_t status;                //SPI__TRANSFER_* status, set by the driver
+};
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void SPI__Reset(void);
+bool SPI__Queue(SPI__Transfer_t *transfer);
+bool SPI__IsBusy(void);
+void SPI__TransferHandler(void);
+
+#endif //_SPI_CTL_H_
@@ -0,0 +1,329 @@
+// *****************************************************************************
+// *  File: timerwheel.c
+// *
+// *  Purpose:
+// *  This file defines the hierarchical timer wheel engine. Level 0 holds timers
+// *  due within the next TWHEEL__NUM_SLOTS ticks, each higher level covers a
+// *  range TWHEEL__NUM_SLOTS times longer. Higher level buckets are cascaded
+// *  down when the lower level wraps, so every timer is only moved a bounded
+// *  number of times and a tick never scans idle timers.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "timerwheel.h"
+
+//*****************************************************************************
+// Purpose: Link a timer into the bucket matching its expiry tick. The level is
+//          selected by how far away the expiry is from the current tick, an
+//          expiry beyond the top level is held in the top level bucket which
+//          is cascaded next for the expiry slot.
+// Argument: wheel - Timer wheel
+//           timerId - Timer to insert, expiry must already be set
+// Return: None
+//
+//*****************************************************************************
+
+static void InsertTimer(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    TWHEEL__Timer_t *timer = &wheel->timers[timerId];
+    uint16_t delta = timer->expiry - wheel->now;
+    uint8_t level = 0;
+    uint8_t bucket;
+
+    //Find the lowest level with a range covering the expiry
+    while((level < (wheel->numLevels - 1)) && ((delta >> (TWHEEL__SLOT_BITS * (level + 1))) != 0))
+    {
+        level++;
+    }
+
+    bucket = (level * TWHEEL__NUM_SLOTS) + ((timer->expiry >> (TWHEEL__SLOT_BITS * level)) & TWHEEL__SLOT_MASK);
+
+    //Push the timer to the front of the bucket list
+    timer->bucket = bucket;
+    timer->prev = TWHEEL__NO_TIMER;
+    timer->next = wheel->bucketHead[bucket];
+
+    if(timer->next != TWHEEL__NO_TIMER)
+    {
+        wheel->timers[timer->next].prev = timerId;
+    }
+
+    wheel->bucketHead[bucket] = timerId;
+}
+
+//*****************************************************************************
+// Purpose: Unlink a timer from the bucket it is currently held in.
+// Argument: wheel - Timer wheel
+//           timerId - Timer to remove
+// Return: None
+//
+//*****************************************************************************
+
+static void RemoveTimer(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    TWHEEL__Timer_t *timer = &wheel->timers[timerId];
+
+    if(timer->prev != TWHEEL__NO_TIMER)
+    {
+        wheel->timers[timer->prev].next = timer->next;
+    }
+    else
+    {
+        wheel->bucketHead[timer->bucket] = timer->next;
+    }
+
+    if(timer->next != TWHEEL__NO_TIMER)
+    {
+        wheel->timers[timer->next].prev = timer->prev;
+    }
+
+    timer->bucket = TWHEEL__NO_TIMER;
+}
+
+//*****************************************************************************
+// Purpose: Move all timers of a higher level bucket down into the levels
+//          matching their remaining time. Timers still beyond the top level
+//          go back into the top level for another turn.
+// Argument: wheel - Timer wheel
+//           bucket - Bucket to cascade
+// Return: None
+//
+//*****************************************************************************
+
+static void CascadeBucket(TWHEEL__Wheel_t *wheel, uint8_t bucket)
+{
+    uint8_t timerId = wheel->bucketHead[bucket];
+    uint8_t nextId;
+
+    wheel->bucketHead[bucket] = TWHEEL__NO_TIMER;
+
+    while(timerId != TWHEEL__NO_TIMER)
+    {
+        nextId = wheel->timers[timerId].next;
+        InsertTimer(wheel, timerId);
+        timerId = nextId;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Initialise a timer wheel with all timers stopped.
+// Argument: wheel - Timer wheel
+//           timers - Timer storage for the wheel
+//           numTimers - Number of entries in the timer storage
+//           buckets - Bucket storage, TWHEEL__NUM_BUCKETS(numLevels) entries
+//           numLevels - Wheel levels, TWHEEL__MIN_LEVELS to TWHEEL__MAX_LEVELS
+//           expiryHandler - Called for each expiring timer, may be null
+// Return: None
+//
+//*****************************************************************************
+
+void TWHEEL__Init(TWHEEL__Wheel_t *wheel, TWHEEL__Timer_t *timers, uint8_t numTimers, uint8_t *buckets, uint8_t numLevels, TWHEEL__ExpiryHandler_t expiryHandler)
+{
+    uint8_t index;
+
+    wheel->now = 0;
+    wheel->timers = timers;
+    wheel->numTimers = numTimers;
+    wheel->bucketHead = buckets;
+    wheel->numLevels = numLevels;
+    wheel->expiryHandler = expiryHandler;
+
+    for(index = 0; index < TWHEEL__NUM_BUCKETS(numLevels); index++)
+    {
+        wheel->bucketHead[index] = TWHEEL__NO_TIMER;
+    }
+
+    for(index = 0; index < numTimers; index++)
+    {
+        timers[index].bucket = TWHEEL__NO_TIMER;
+    }
+}
+
+//*****************************************************************************
+// Purpose: (Re)start a timer to expire after the specified number of ticks.
+//          Starting a timer with zero ticks stops it.
+// Argument: wheel - Timer wheel
+//           timerId - Timer to start
+//           ticks - Number of ticks until expiry
+// Return: None
+//
+//*****************************************************************************
+
+void TWHEEL__Start(TWHEEL__Wheel_t *wheel, uint8_t timerId, uint16_t ticks)
+{
+    TWHEEL__Stop(wheel, timerId);
+
+    if(ticks > 0)
+    {
+        wheel->timers[timerId].expiry = wheel->now + ticks;
+        InsertTimer(wheel, timerId);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Stop a timer, the timer is removed from the wheel if running.
+// Argument: wheel - Timer wheel
+//           timerId - Timer to stop
+// Return: None
+//
+//*****************************************************************************
+
+void TWHEEL__Stop(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    if(wheel->timers[timerId].bucket != TWHEEL__NO_TIMER)
+    {
+        RemoveTimer(wheel, timerId);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Return the number of ticks left before a timer expires.
+// Argument: wheel - Timer wheel
+//           timerId - Timer to read
+// Return: Remaining ticks, zero when the timer has expired or is stopped
+//
+//*****************************************************************************
+
+uint16_t TWHEEL__Remaining(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    uint16_t remaining = 0;
+
+    if(wheel->timers[timerId].bucket != TWHEEL__NO_TIMER)
+    {
+        remaining = wheel->timers[timerId].expiry - wheel->now;
+    }
+
+    return remaining;
+}
+
+//*****************************************************************************
+// Purpose: Advance the wheel by one tick. Higher level buckets are cascaded
+//          when the lower level wraps, then every timer in the current level 0
+//          slot is expired.
+// Argument: wheel - Timer wheel
+// Return: None
+//
+//*****************************************************************************
+
+void TWHEEL__Tick(TWHEEL__Wheel_t *wheel)
+{
+    uint8_t level = 1;
+    uint8_t slot;
+    uint8_t timerId;
+    uint8_t nextId;
+
+    wheel->now++;
+    slot = wheel->now & TWHEEL__SLOT_MASK;
+
+    //Cascade each level whose lower level has just wrapped around
+    while((slot == 0) && (level < wheel->numLevels))
+    {
+        slot = (wheel->now >> (TWHEEL__SLOT_BITS * level)) & TWHEEL__SLOT_MASK;
+        CascadeBucket(wheel, (level * TWHEEL__NUM_SLOTS) + slot);
+        level++;
+    }
+
+    //Every timer left in the current level 0 slot expires on this tick
+    slot = wheel->now & TWHEEL__SLOT_MASK;
+    timerId = wheel->bucketHead[slot];
+    wheel->bucketHead[slot] = TWHEEL__NO_TIMER;
+
+    while(timerId != TWHEEL__NO_TIMER)
+    {
+        //Read the link first, the expiry handler may restart the timer
+        nextId = wheel->timers[timerId].next;
+        wheel->timers[timerId].bucket = TWHEEL__NO_TIMER;
+
+        if(wheel->expiryHandler != 0)
+        {
+            wheel->expiryHandler(wheel, timerId);
+        }
+
+        timerId = nextId;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Advance the wheel by a number of ticks in one step. The skipped
+//          ticks must not hold any wheel event, the caller must not advance
+//          past the count returned by TWHEEL__TicksToNextEvent.
+// Argument: wheel - Timer wheel
+//           ticks - Number of ticks to advance
+// Return: None
+//
+//*****************************************************************************
+
+void TWHEEL__Advance(TWHEEL__Wheel_t *wheel, uint16_t ticks)
+{
+    if(ticks > 0)
+    {
+        //Intermediate ticks have nothing to expire or cascade, only the last
+        //tick needs to be processed
+        wheel->now += (ticks - 1);
+        TWHEEL__Tick(wheel);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Determine the number of ticks until the wheel next has work to do,
+//          either a timer expiring or a non empty bucket to be cascaded.
+// Argument: wheel - Timer wheel
+// Return: Ticks until the next event, TWHEEL__NO_PENDING_EVENT if no timer is
+//         running
+//
+//*****************************************************************************
+
+uint16_t TWHEEL__TicksToNextEvent(TWHEEL__Wheel_t *wheel)
+{
+    uint32_t nextEvent = 0x10000;
+    uint32_t delta;
+    uint16_t period;
+    uint8_t level;
+    uint8_t index;
+    uint8_t slot;
+
+    //Level 0 slots are visited on every tick
+    for(index = 1; index <= TWHEEL__NUM_SLOTS; index++)
+    {
+        slot = (wheel->now + index) & TWHEEL__SLOT_MASK;
+
+        if(wheel->bucketHead[slot] != TWHEEL__NO_TIMER)
+        {
+            nextEvent = index;
+            break;
+        }
+    }
+
+    //Higher level slots are visited when all lower levels wrap around
+    for(level = 1; level < wheel->numLevels; level++)
+    {
+        period = (uint16_t)1 << (TWHEEL__SLOT_BITS * level);
+        delta = period - (wheel->now & (period - 1));
+
+        for(index = 0; (index < TWHEEL__NUM_SLOTS) && (delta < nextEvent); index++)
+        {
+            slot = ((uint16_t)(wheel->now + delta) >> (TWHEEL__SLOT_BITS * level)) & TWHEEL__SLOT_MASK;
+
+            if(wheel->bucketHead[(level * TWHEEL__NUM_SLOTS) + slot] != TWHEEL__NO_TIMER)
+            {
+                nextEvent = delta;
+                break;
+            }
+
+            delta += period;
+        }
+    }
+
+    if(nextEvent > 0xFFFF)
+    {
+        nextEvent = TWHEEL__NO_PENDING_EVENT;
+    }
+
+    return (uint16_t)nextEvent;
+}
@@ -0,0 +1,94 @@
+// *****************************************************************************
+// *  File: timerwheel.h
+// *
+// *  Purpose:
+// *  This is the header file for the hierarchical timer wheel engine used by the
+// *  software timer drivers. Timers are bucketed by expiry slot so that a tick
+// *  only touches the timers which expire in that slot. The number of levels
+// *  is set per wheel, so the bucket RAM can be sized to each timer range.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _TIMERWHEEL_H_
+#define _TIMERWHEEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_TIMERWHEEL
+
+//*****************************************************************************
+//
+// Timer wheel configuration constants defined here
+//
+//*****************************************************************************
+
+//Each wheel level holds 2^TWHEEL__SLOT_BITS slots with a one byte bucket
+//head each. Timers beyond the range of the levels are held on the top level
+//and cascaded again on every turn of it until they come into range, so a
+//wheel needs at least two levels but need not cover the 16 bit tick range.
+#define TWHEEL__SLOT_BITS                   2
+#define TWHEEL__NUM_SLOTS                   (1 << TWHEEL__SLOT_BITS)
+#define TWHEEL__SLOT_MASK                   (TWHEEL__NUM_SLOTS - 1)
+#define TWHEEL__MIN_LEVELS                  2
+#define TWHEEL__MAX_LEVELS                  ((16 + TWHEEL__SLOT_BITS - 1) / TWHEEL__SLOT_BITS)
+
+//Bucket storage needed by a wheel with the given number of levels
+#define TWHEEL__NUM_BUCKETS(levels)         ((levels) * TWHEEL__NUM_SLOTS)
+
+//Index used to terminate the bucket lists, limits a wheel to 255 timers
+#define TWHEEL__NO_TIMER                    0xFF
+#define TWHEEL__MAX_TIMERS                  TWHEEL__NO_TIMER
+
+//Returned when no timer is running on the wheel
+#define TWHEEL__NO_PENDING_EVENT            0
+
+//*****************************************************************************
+//
+// Timer wheel data types defined here
+//
+//*****************************************************************************
+
+typedef struct {
+    uint16_t expiry;    //Absolute tick at which the timer expires
+    uint8_t next;       //Next timer in the bucket list
+    uint8_t prev;       //Previous timer in the bucket list
+    uint8_t bucket;     //Bucket holding the timer, TWHEEL__NO_TIMER when idle
+} TWHEEL__Timer_t;
+
+typedef struct TWHEEL__Wheel TWHEEL__Wheel_t;
+
+//Called from TWHEEL__Tick for every timer expiring on the tick, the timer may
+//be restarted from within the handler
+typedef void (*TWHEEL__ExpiryHandler_t)(TWHEEL__Wheel_t *wheel, uint8_t timerId);
+
+struct TWHEEL__Wheel {
+    uint16_t now;                               //Current wheel tick
+    uint8_t numTimers;                          //Size of the timer storage
+    uint8_t numLevels;                          //Wheel levels, TWHEEL__MIN_LEVELS to TWHEEL__MAX_LEVELS
+    TWHEEL__Timer_t *timers;                    //Timer storage, owned by the driver
+    uint8_t *bucketHead;                        //First timer in each bucket, owned by the driver
+    TWHEEL__ExpiryHandler_t expiryHandler;      //Optional expiry notification
+};
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void TWHEEL__Init(TWHEEL__Wheel_t *wheel, TWHEEL__Timer_t *timers, uint8_t numTimers, uint8_t *buckets, uint8_t numLevels, TWHEEL__ExpiryHandler_t expiryHandler);
+void TWHEEL__Start(TWHEEL__Wheel_t *wheel, uint8_t timerId, uint16_t ticks);
+void TWHEEL__Stop(TWHEEL__Wheel_t *wheel, uint8_t timerId);
+uint16_t TWHEEL__Remaining(TWHEEL__Wheel_t *wheel, uint8_t timerId);
+void TWHEEL__Tick(TWHEEL__Wheel_t *wheel);
+void TWHEEL__Advance(TWHEEL__Wheel_t *wheel, uint16_t ticks);
+uint16_t TWHEEL__TicksToNextEvent(TWHEEL__Wheel_t *wheel);
+
+#endif //_TIMERWHEEL_H_
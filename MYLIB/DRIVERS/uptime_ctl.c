@@ -0,0 +1,284 @@
+// *****************************************************************************
+// *  File: uptime_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the monotonic uptime clock.
+// *  The overflow count and the timer count are sampled together with
+// *  interrupts held off, so a timestamp never tears across a timer wrap.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "uptime_ctl.h"
+
+// Private variables defined here
+typedef struct {
+    uint64_t count;         //Timer count of the last rebase
+    uint64_t time;          //Uptime in whole microseconds at count
+    uint32_t fraction;      //Part microsecond at count, scaled by 2^UPTIME__SCALE_SHIFT
+    uint32_t multiplier;    //Microseconds per timer count, scaled by 2^UPTIME__SCALE_SHIFT
+} ConversionBase_t;
+
+static volatile uint32_t Overflows;     //Timer A wraps since reset, upper bits of the count
+static ConversionBase_t Base;
+
+//*****************************************************************************
+// Purpose: Sample the extended timer count, called with interrupts disabled.
+//          An overflow whose interrupt has not been serviced yet, e.g. when
+//          called from another handler, is accounted for from the pending
+//          TAIFG flag.
+// Argument: None
+// Return: Timer A counts since reset
+//
+//*****************************************************************************
+
+static uint64_t ReadCount(void)
+{
+    uint32_t overflows = Overflows;
+    uint16_t count = HWREG16(TIMERA_TAR_REG_ADDR);
+
+    if((HWREG16(TIMERA_TACTL_REG_ADDR) & TIMERA_TAIFG_MASK) && (count < UPTIME__WRAP_WINDOW))
+    {
+        overflows++;
+    }
+
+    return (((uint64_t)overflows << 16) | count);
+}
+
+//*****************************************************************************
+// Purpose: Convert a timer count to microseconds since reset against a copy
+//          of the conversion base, runs with interrupts enabled. A count
+//          sampled before the base is converted backwards from it.
+// Argument: base - Conversion base
+//           count - Extended timer count, within 2^32 counts of the base
+// Return: Microseconds since reset
+//
+//*****************************************************************************
+
+static uint64_t ConvertCount(const ConversionBase_t *base, uint64_t count)
+{
+    uint64_t scaled;
+
+    if(count >= base->count)
+    {
+        scaled = ((uint64_t)(uint32_t)(count - base->count) * base->multiplier) + base->fraction;
+
+        return (base->time + (scaled >> UPTIME__SCALE_SHIFT));
+    }
+
+    scaled = (uint64_t)(uint32_t)(base->count - count) * base->multiplier;
+
+    if(scaled <= base->fraction)
+    {
+        return base->time;
+    }
+
+    return (base->time - ((scaled - base->fraction + UPTIME__SCALE_MASK) >> UPTIME__SCALE_SHIFT));
+}
+
+//*****************************************************************************
+// Purpose: Move the conversion base up to a timer count, keeping the part
+//          microsecond so no time is lost. Called with interrupts disabled.
+// Argument: count - Extended timer count
+// Return: None
+//
+//*****************************************************************************
+
+static void Rebase(uint64_t count)
+{
+    uint64_t scaled = ((uint64_t)(uint32_t)(count - Base.count) * Base.multiplier) + Base.fraction;
+
+    Base.time += scaled >> UPTIME__SCALE_SHIFT;
+    Base.fraction = (uint32_t)(scaled & UPTIME__SCALE_MASK);
+    Base.count = count;
+}
+
+//*****************************************************************************
+// Purpose: Set the conversion rate for a Timer A clock frequency.
+// Argument: timer_hz - Timer A clock frequency in Hz
+// Return: None
+//
+//*****************************************************************************
+
+static void SetMultiplier(uint32_t timer_hz)
+{
+    Base.multiplier = (uint32_t)(((uint64_t)UPTIME__US_PER_SECOND << UPTIME__SCALE_SHIFT) / timer_hz);
+}
+
+//*****************************************************************************
+// Purpose: Clock change handler, called with interrupts disabled once the
+//          Timer A clock has changed. Time counted so far is kept at the old
+//          rate.
+// Argument: timer_hz - New Timer A clock frequency in Hz
+// Return: None
+//
+//*****************************************************************************
+
+static void ClockChanged(uint32_t timer_hz)
+{
+    Rebase(ReadCount());
+    SetMultiplier(timer_hz);
+}
+
+#if LIBUTIL__ERROR_TIMESTAMPS
+
+//*****************************************************************************
+// Purpose: Error log timestamp source, called with interrupts disabled. Only
+//          the count is read, the conversion is left to ErrorTime.
+// Argument: None
+// Return: Timer A counts since reset, modulo 2^32
+//
+//*****************************************************************************
+
+static uint32_t ErrorTimestamp(void)
+{
+    return (uint32_t)ReadCount();
+}
+
+//*****************************************************************************
+// Purpose: Convert an error log timestamp when the log is read. The count is
+//          extended from the current count and converted at the current
+//          Timer A rate, an error from before the last clock change or more
+//          than 2^32 counts ago, 71 minutes on a 1MHz clock, reads back with
+//          a skewed time.
+// Argument: raw - Timer A counts since reset, modulo 2^32
+// Return: Milliseconds since reset, modulo 2^32
+//
+//*****************************************************************************
+
+static uint32_t ErrorTime(uint32_t raw)
+{
+    uint64_t now = UPTIME__NowCount();
+
+    return (uint32_t)(UPTIME__CountToTime(now - (uint32_t)((uint32_t)now - raw)) / UPTIME__US_PER_MS);
+}
+
+#endif
+
+//*****************************************************************************
+// Purpose: Reset the uptime clock to zero and enable the Timer A overflow
+//          interrupt. Errors logged from here on are timestamped with the
+//          uptime when the log keeps timestamps. Must be called after
+//          HW__InitialiseSystem has started Timer A in continuous mode.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void UPTIME__Reset(void)
+{
+    uint16_t state = INT__EnterCritical();
+
+    HWREG16(TIMERA_TACTL_REG_ADDR) &= ~TIMERA_TAIFG_MASK;
+    Overflows = 0;
+    Base.count = 0;
+    Base.time = 0;
+    Base.fraction = 0;
+    SetMultiplier(HW__GetTimerClockFrequency());
+    HW__RegisterClockHandler(HW__CLOCK_USER_UPTIME, ClockChanged);
+    HW__RequestClocks(HW__CLOCK_USER_UPTIME, HW__CLOCK_TIMERA);
+#if LIBUTIL__ERROR_TIMESTAMPS
+    LIBUTIL__SetTimestampSource(ErrorTimestamp, ErrorTime);
+#endif
+    INT__Enable(TIMERA_INT);
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Read the 64 bit uptime, does not wrap within the life of the
+//          device. Interrupts are only held off to sample the count together
+//          with its conversion base.
+// Argument: None
+// Return: Microseconds since reset
+//
+//*****************************************************************************
+
+uint64_t UPTIME__Now64(void)
+{
+    ConversionBase_t base;
+    uint64_t count;
+    uint16_t state = INT__EnterCritical();
+
+    count = ReadCount();
+    base = Base;
+    INT__ExitCritical(state);
+
+    return ConvertCount(&base, count);
+}
+
+//*****************************************************************************
+// Purpose: Read the 32 bit uptime. The value wraps after about 71 minutes,
+//          intervals are measured by unsigned subtraction of two timestamps.
+// Argument: None
+// Return: Microseconds since reset, modulo 2^32
+//
+//*****************************************************************************
+
+uint32_t UPTIME__Now32(void)
+{
+    return (uint32_t)UPTIME__Now64();
+}
+
+//*****************************************************************************
+// Purpose: Read the raw extended timer count, a cheap timestamp for interrupt
+//          handlers to be converted later with UPTIME__CountToTime. The count
+//          rate follows the Timer A clock.
+// Argument: None
+// Return: Timer A counts since reset
+//
+//*****************************************************************************
+
+uint64_t UPTIME__NowCount(void)
+{
+    uint64_t count;
+    uint16_t state = INT__EnterCritical();
+
+    count = ReadCount();
+    INT__ExitCritical(state);
+
+    return count;
+}
+
+//*****************************************************************************
+// Purpose: Convert a count read with UPTIME__NowCount to microseconds since
+//          reset. The count must be sampled since the last Timer A clock
+//          change, and no more than 2^31 counts before it is converted.
+// Argument: count - Extended timer count
+// Return: Microseconds since reset
+//
+//*****************************************************************************
+
+uint64_t UPTIME__CountToTime(uint64_t count)
+{
+    ConversionBase_t base;
+    uint16_t state = INT__EnterCritical();
+
+    base = Base;
+    INT__ExitCritical(state);
+
+    return ConvertCount(&base, count);
+}
+
+//*****************************************************************************
+// Purpose: Timer A overflow handler, called from the Timer A1 interrupt
+//          vector once TAIV has reported the overflow.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void UPTIME__OverflowHandler(void)
+{
+    Overflows++;
+
+    if((Overflows & UPTIME__REBASE_OVERFLOW_MASK) == 0)
+    {
+        Rebase(ReadCount());
+    }
+}
@@ -0,0 +1,66 @@
+// *****************************************************************************
+// *  File: uptime_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the monotonic uptime clock. Timer A runs
+// *  continuously for the soft timer service, a software count of its overflows
+// *  extends the live TAR count into 32 and 64 bit microsecond timestamps.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _UPTIME_CTL_H_
+#define _UPTIME_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "softtimer_ctl.h"
+#include <stdint.h>
+
+#define COMPILED_UPTIME_CTL
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//Timer A is clocked from SMCLK or ACLK undivided, the count rate follows
+//whichever clock the power manager has selected
+#define UPTIME__US_PER_SECOND               1000000
+#define UPTIME__US_PER_MS                   1000
+
+//Counts are converted relative to a base which moves on every 2^15
+//overflows, so the counts since the base always fit 32 bits
+#define UPTIME__REBASE_OVERFLOW_MASK        0x7FFF
+
+//Counts are converted with a multiply by the microseconds per count, scaled
+//by 2^UPTIME__SCALE_SHIFT, instead of a divide by the clock frequency. The
+//scaled value fits 32 bits for timer clocks from 3.9kHz, and is exact for
+//1MHz, 8MHz, 16MHz and 32768Hz.
+#define UPTIME__SCALE_SHIFT                 24
+#define UPTIME__SCALE_MASK                  ((1UL << UPTIME__SCALE_SHIFT) - 1)
+
+//A pending overflow flag only belongs to the sampled count if the count has
+//just wrapped, reads never take longer than half the timer range
+#define UPTIME__WRAP_WINDOW                 0x8000
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void UPTIME__Reset(void);
+uint64_t UPTIME__Now64(void);
+uint32_t UPTIME__Now32(void);
+uint64_t UPTIME__NowCount(void);
+uint64_t UPTIME__CountToTime(uint64_t count);
+void UPTIME__OverflowHandler(void);
+
+#endif //_UPTIME_CTL_H_
@@ -0,0 +1,287 @@
+// *****************************************************************************
+// *  File: watchdog_ctl.c
+// *
+// *  Purpose:
+// *  This file defines the various functions for the watchdog manager. The
+// *  check in window is closed by a soft timer callback, so a task hogging
+// *  the CPU or a stalled soft timer service also stops the watchdog being
+// *  cleared. The reset cause is logged to the error log on start up.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "watchdog_ctl.h"
+
+// Public variables defined here
+volatile uint16_t WATCHDOG__CheckIns;       //Check ins arrived in the current window
+
+// Private variables defined here
+static uint16_t RequiredCheckIns;           //Check ins needed to clear the watchdog
+static uint16_t WatchdogConfig;             //Watchdog control bits, less the password
+static bool WindowMissed;                   //Watchdog left to expire after a missed window
+static uint8_t ResetCause;                  //IFG1 reset flags found on start up
+static uint16_t LastMissedCheckIns;         //Check ins missed before the last watchdog reset
+static WATCHDOG__Callback_t IntervalCallback;
+
+//Kept through the watchdog reset which follows a missed window
+static LIBUTIL__NO_INIT uint16_t MissSignature;
+static LIBUTIL__NO_INIT uint16_t MissedCheckIns;
+
+//*****************************************************************************
+// Purpose: Write the watchdog control register with the password.
+// Argument: control - Watchdog control bits
+// Return: None
+//
+//*****************************************************************************
+
+static inline void WriteControl(uint16_t control)
+{
+    HWREG16(WATCHDOG_CONTROL_REG_ADDR) = WATCHDOG_PASSWORD | control;
+}
+
+//*****************************************************************************
+// Purpose: Start the watchdog with the current configuration. An ACLK sourced
+//          watchdog is held instead while the crystal is not running, it would
+//          fail safe onto MCLK and expire within milliseconds.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StartWatchdog(void)
+{
+    if((WatchdogConfig & WATCHDOG_SOURCE_ACLK) && !HW__IsCrystalRunning())
+    {
+        WriteControl(WatchdogConfig | WATCHDOG_HOLD);
+    }
+    else
+    {
+        WriteControl(WatchdogConfig | WATCHDOG_COUNTER_CLEAR);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Read and clear the reset flags, and log the cause of a reset other
+//          than power on. A watchdog reset is told apart from a check in miss
+//          by the signature left in uninitialised memory.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void RecordResetCause(void)
+{
+    ResetCause = HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) & (SFR_WATCHDOG_MASK + SFR_POWER_ON_RESET_MASK + SFR_PIN_RESET_MASK);
+    HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) &= ~ResetCause;
+    LastMissedCheckIns = 0;
+
+    if(ResetCause & SFR_POWER_ON_RESET_MASK)
+    {
+        //Memory content is undefined after power on, nothing to report
+    }
+    else if(ResetCause & SFR_WATCHDOG_MASK)
+    {
+        if(MissSignature == WATCHDOG__MISS_SIGNATURE)
+        {
+            LastMissedCheckIns = MissedCheckIns;
+            LIBUTIL__LogError(WATCHDOG__CHECKIN_MISSED);
+        }
+        else
+        {
+            LIBUTIL__LogError(WATCHDOG__WATCHDOG_RESET);
+        }
+    }
+    else if(ResetCause & SFR_PIN_RESET_MASK)
+    {
+        LIBUTIL__LogError(WATCHDOG__PIN_RESET);
+    }
+
+    MissSignature = 0;
+}
+
+//*****************************************************************************
+// Purpose: Soft timer callback closing the check in window. The watchdog is
+//          cleared if every required check in arrived, otherwise it is left
+//          to expire and the missed check ins are kept for the next start up.
+//          A watchdog held for a crystal fault is restarted once the crystal
+//          is running again.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void WindowTimerExpired(void)
+{
+    uint16_t checkins;
+    uint16_t state;
+
+    if((WatchdogConfig & WATCHDOG_SOURCE_ACLK) && !HW__IsCrystalRunning())
+    {
+        return;
+    }
+
+    if(WatchdogConfig & WATCHDOG_INTERVAL_MODE)
+    {
+        if(HWREG16(WATCHDOG_CONTROL_REG_ADDR) & WATCHDOG_HOLD)
+        {
+            StartWatchdog();
+        }
+
+        return;
+    }
+
+    state = INT__EnterCritical();
+    checkins = WATCHDOG__CheckIns;
+    WATCHDOG__CheckIns = 0;
+    INT__ExitCritical(state);
+
+    if(WindowMissed)
+    {
+        return;
+    }
+
+    if((checkins & RequiredCheckIns) == RequiredCheckIns)
+    {
+        WriteControl(WatchdogConfig | WATCHDOG_COUNTER_CLEAR);
+    }
+    else
+    {
+        MissedCheckIns = RequiredCheckIns & ~checkins;
+        MissSignature = WATCHDOG__MISS_SIGNATURE;
+        WindowMissed = true;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Record the reset cause and start the watchdog in reset mode with
+//          no check ins required. Must be called after the soft timer service
+//          has been reset, the watchdog is held from HW__InitialiseSystem up
+//          to here.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void WATCHDOG__Reset(void)
+{
+    RecordResetCause();
+
+    INT__Disable(WATCHDOG_INT);
+    WATCHDOG__CheckIns = 0;
+    RequiredCheckIns = 0;
+    WindowMissed = false;
+    IntervalCallback = 0;
+    WatchdogConfig = WATCHDOG__CONFIG;
+    StartWatchdog();
+
+    SOFTTMR__RegisterCallback(SOFTTMR__RES_100MS, WATCHDOG_SOFT_TIMER, WindowTimerExpired, WATCHDOG__WINDOW_PERIOD, SOFTTMR__AUTO_RELOAD);
+}
+
+//*****************************************************************************
+// Purpose: Add or remove a check in from the set needed in every window. A
+//          newly required check in counts as arrived in the current window.
+// Argument: checkin - WATCHDOG__CHECKIN_* ID
+//           required - True to require the check in
+// Return: None
+//
+//*****************************************************************************
+
+void WATCHDOG__Require(uint8_t checkin, bool required)
+{
+    uint16_t mask;
+    uint16_t state;
+
+    if(checkin >= WATCHDOG__NUM_CHECKINS)
+    {
+        LIBUTIL__LogError(WATCHDOG__INVALID_CHECKIN);
+        return;
+    }
+
+    mask = (uint16_t)(1 << checkin);
+    state = INT__EnterCritical();
+
+    if(required)
+    {
+        RequiredCheckIns |= mask;
+        WATCHDOG__CheckIns |= mask;
+    }
+    else
+    {
+        RequiredCheckIns &= ~mask;
+    }
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Run the watchdog as an interval timer instead, for applications
+//          which do not need the reset function. Check ins are no longer
+//          watched.
+// Argument: interval - WATCHDOG_INTERVAL_* select, in periods of the
+//                      WATCHDOG__CONFIG clock
+//           callback - Called from the watchdog interrupt every interval
+// Return: None
+//
+//*****************************************************************************
+
+void WATCHDOG__StartInterval(uint8_t interval, WATCHDOG__Callback_t callback)
+{
+    uint16_t state = INT__EnterCritical();
+
+    IntervalCallback = callback;
+    WatchdogConfig = WATCHDOG_INTERVAL_MODE + (WATCHDOG__CONFIG & WATCHDOG_SOURCE_ACLK) + (interval & WATCHDOG_INTERVAL_64);
+    StartWatchdog();
+
+    HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) &= ~SFR_WATCHDOG_MASK;
+    INT__Enable(WATCHDOG_INT);
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Read the cause of the last reset.
+// Argument: None
+// Return: IFG1 reset flags, SFR_WATCHDOG_MASK, SFR_POWER_ON_RESET_MASK and
+//         SFR_PIN_RESET_MASK
+//
+//*****************************************************************************
+
+uint8_t WATCHDOG__GetResetCause(void)
+{
+    return ResetCause;
+}
+
+//*****************************************************************************
+// Purpose: Read the check ins which were missed before the last watchdog
+//          reset.
+// Argument: None
+// Return: Mask of WATCHDOG__CHECKIN_* bits, 0 if the last reset was not a
+//         check in miss
+//
+//*****************************************************************************
+
+uint16_t WATCHDOG__GetMissedCheckIns(void)
+{
+    return LastMissedCheckIns;
+}
+
+//*****************************************************************************
+// Purpose: Watchdog interval handler, called from the watchdog interrupt
+//          vector. The interrupt flag is cleared by the interrupt itself.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void WATCHDOG__IntervalHandler(void)
+{
+    if(IntervalCallback)
+    {
+        IntervalCallback();
+    }
+}
@@ -0,0 +1,108 @@
+// *****************************************************************************
+// *  File: watchdog_ctl.h
+// *
+// *  Purpose:
+// *  This is the header file for the watchdog manager. Tasks and interrupt
+// *  handlers check in by setting their bit in a shared mask, the watchdog is
+// *  only cleared once every required check in has arrived within a window.
+// *  The watchdog may instead be run as an interval timer.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _WATCHDOG_CTL_H_
+#define _WATCHDOG_CTL_H_
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include "softtimer_ctl.h"
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_WATCHDOG_CTL
+
+//*****************************************************************************
+//
+// Watchdog check ins defined and registered here, up to 16
+//
+//*****************************************************************************
+
+enum
+{
+    WATCHDOG__CHECKIN_APPLICATION = 0,
+    WATCHDOG__NUM_CHECKINS
+};
+
+//*****************************************************************************
+//
+// Driver configuration constants defined here
+//
+//*****************************************************************************
+
+//Watchdog clocked from the ACLK crystal, 32768 periods or 1s. The watchdog
+//keeps running in LPM3, it is held while the crystal is faulty.
+#define WATCHDOG__CONFIG                    (WATCHDOG_SOURCE_ACLK + WATCHDOG_INTERVAL_32768)
+
+//Check in window in 100ms soft timer ticks. Must be well inside the watchdog
+//interval, a missed window resets the device within one interval.
+#define WATCHDOG__WINDOW_PERIOD             5
+
+//Marks a check in miss recorded before a watchdog reset
+#define WATCHDOG__MISS_SIGNATURE            0xA5C3
+
+#define WATCHDOG__WATCHDOG_RESET            80  //Watchdog expired, cause not recorded
+#define WATCHDOG__CHECKIN_MISSED            81  //Watchdog expired after a missed check in
+#define WATCHDOG__PIN_RESET                 82  //Reset from the RST pin
+#define WATCHDOG__INVALID_CHECKIN           83
+
+//*****************************************************************************
+//
+// Driver data types defined here
+//
+//*****************************************************************************
+
+//Interval timer callback, called from the watchdog interrupt handler
+typedef void (*WATCHDOG__Callback_t)(void);
+
+//*****************************************************************************
+//
+// Check in helpers defined here
+//
+//*****************************************************************************
+
+extern volatile uint16_t WATCHDOG__CheckIns;
+
+//*****************************************************************************
+// Purpose: Check in for the current window, safe from any task or interrupt
+//          handler. The OR compiles to a single BIS instruction so it can not
+//          be torn by an interrupt.
+// Argument: checkin - WATCHDOG__CHECKIN_* ID
+// Return: None
+//
+//*****************************************************************************
+
+static inline void WATCHDOG__CheckIn(uint8_t checkin)
+{
+    WATCHDOG__CheckIns |= (uint16_t)(1 << checkin);
+}
+
+//*****************************************************************************
+//
+// Function prototype defined here
+//
+//*****************************************************************************
+
+void WATCHDOG__Reset(void);
+void WATCHDOG__Require(uint8_t checkin, bool required);
+void WATCHDOG__StartInterval(uint8_t interval, WATCHDOG__Callback_t callback);
+uint8_t WATCHDOG__GetResetCause(void);
+uint16_t WATCHDOG__GetMissedCheckIns(void);
+void WATCHDOG__IntervalHandler(void);
+
+#endif //_WATCHDOG_CTL_H_
@@ -0,0 +1,1880 @@
+// *****************************************************************************
+// *  File: hostsim.c
+// *
+// *  Purpose:
+// *  This file defines the host register simulator. The register file is a
+// *  byte array indexed by the MSP430 address, the drivers access it through
+// *  the HWREG macros. Peripherals are updated on clock edges, the oscillators
+// *  are stepped in picoseconds from one edge to the next so clocks of any
+// *  frequency ratio can be mixed.
+// *
+// *  Register writes are not trapped, their side effects (TACLR, ADC10SC,
+// *  watchdog password, port outputs) are applied on the next register access,
+// *  status register change or delay. Reading TAIV and accessing ADC10SA have
+// *  their side effects applied on access.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hostsim.h"
+#include "hardware_ctl.h"
+#include <math.h>
+#include <setjmp.h>
+#include <string.h>
+
+//*****************************************************************************
+//
+// Private constants defined here
+//
+//*****************************************************************************
+
+//Raw register file access, bypasses the access accounting of the HWREG macros
+#define REG8(address)       (Memory.byte[(address)])
+#define REG16(address)      (Memory.word[(address) >> 1])
+
+#define PS_PER_SECOND       1000000000000.0
+#define PS_PER_US           1000000ULL
+#define PS_PER_NS           1000ULL
+#define NO_EDGE             UINT64_MAX
+
+#define RUN_RESET           3       //Internal HOSTSIM__Run restart after a PUC
+
+#define WDTCTL_READ_KEY     0x69
+#define WDTCTL_WRITE_KEY    0x5A
+
+#define CLOCK_DCO           0
+#define CLOCK_LF            1
+
+//Timer_A clock sources, TASSEL
+#define TIMER_SOURCE_ACLK   1
+#define TIMER_SOURCE_SMCLK  2
+
+//ADC10 clock sources, ADC10SSEL
+#define ADC_SOURCE_OSC      0
+#define ADC_SOURCE_ACLK     1
+#define ADC_SOURCE_MCLK     2
+#define ADC_SOURCE_SMCLK    3
+
+#define ADC_IDLE            0
+#define ADC_SAMPLE          1
+#define ADC_CONVERT         2
+#define ADC_CONVERT_CLOCKS  13
+
+//USI clock sources, USISSEL 2 and 3 both select SMCLK
+#define USI_CLOCK_ACLK      1
+#define USI_CLOCK_SMCLK     2
+#define USICNT_BITS         0x1F
+
+#define NUM_PORTS           2
+
+//*****************************************************************************
+//
+// Private data types defined here
+//
+//*****************************************************************************
+
+typedef struct {
+    double hz;
+    uint64_t periodPs;
+    uint64_t nextEdgePs;
+    bool running;
+} Oscillator_t;
+
+typedef struct {
+    uint16_t address;
+    uint16_t size;
+    uint8_t *data;
+} Mapping_t;
+
+typedef struct {
+    uint64_t timePs;
+    HOSTSIM__Event_t event;
+} Event_t;
+
+//*****************************************************************************
+//
+// Interrupt handlers defined in interrupt.c
+//
+//*****************************************************************************
+
+extern void GPIO_PORT1_Handler(void);
+extern void GPIO_PORT2_Handler(void);
+extern void TIMERA0_HANDLER(void);
+extern void TIMERA1_HANDLER(void);
+extern void NMI_HANDLER(void);
+extern void WDT_HANDLER(void);
+extern void ADC10_HANDLER(void);
+extern void USI_HANDLER(void);
+
+//*****************************************************************************
+//
+// Simulator state defined here
+//
+//*****************************************************************************
+
+static union {
+    uint8_t byte[HOSTSIM__MEMORY_SIZE];
+    uint16_t word[HOSTSIM__MEMORY_SIZE / 2];
+    uint32_t dword[HOSTSIM__MEMORY_SIZE / 4];
+} Memory;
+
+static uint32_t BadAccess[2];           //Target of accesses outside the register file
+
+static uint16_t StatusRegister;
+static uint16_t StackedSR[HOSTSIM__MAX_NESTING];
+static uint8_t NestingDepth;
+
+static uint64_t NowPs;
+static uint64_t Cycles;
+static uint32_t ResetCount;
+
+static bool Running;
+static uint64_t RunLimitPs;
+static jmp_buf RunExit;
+
+static HOSTSIM__Vector_t Vector[HOSTSIM__NUM_VECTORS];
+static HOSTSIM__VectorStats_t VectorStats[HOSTSIM__NUM_VECTORS];
+
+static Event_t Event[HOSTSIM__MAX_EVENTS];
+static uint8_t NumEvents;
+
+static Mapping_t Mapping[HOSTSIM__MAX_MAPPINGS];
+static uint8_t NumMappings;
+static uint16_t NextMapAddress;
+
+//Basic clock system
+static Oscillator_t Dco;
+static Oscillator_t Lf;
+static Oscillator_t AdcOsc;
+static uint16_t DcoSetting = 0xFFFF;    //DCOCTL and BCSCTL1 the DCO frequency was calculated for
+static uint8_t MclkSource, SmclkSource;
+static bool MclkOn, SmclkOn;
+static uint8_t MclkDivider, SmclkDivider, AclkDivider;
+static uint8_t MclkCount, SmclkCount, AclkCount;
+static bool CrystalPresent;
+static bool CrystalStarted;
+static uint32_t CrystalStartupUs;
+static uint64_t CrystalReadyPs;
+static bool CrystalFault;
+
+//Ports
+static uint8_t PortDriveMask[NUM_PORTS];
+static uint8_t PortDriveLevel[NUM_PORTS];
+
+//Timer_A
+static uint8_t TimerCount;
+static bool TimerCountDown;
+static bool TimerOut[HOSTSIM__TIMERA_NUM_CCR];
+static bool CaptureInput[HOSTSIM__TIMERA_NUM_CCR];
+
+//Watchdog
+static uint16_t WdtCount;
+static uint8_t WdtControl;              //Last accepted WDTCTL low byte
+
+//ADC10
+static uint16_t AnalogInput[HOSTSIM__NUM_ANALOG_CHANNELS];
+static uint8_t AdcState;
+static uint8_t AdcClocks;
+static uint8_t AdcCount;
+static uint8_t AdcChannel;
+static bool AdcSequence;
+static bool DtcRestart;
+static bool DtcActive;
+static uint8_t DtcIndex;
+static bool DtcSecondBlock;
+
+//USI
+static uint8_t UsiCount;                //Bit counter as last written or counted
+static uint8_t UsiDivCount;
+static uint8_t UsiBits;                 //Bits shifted into the current byte
+static uint8_t UsiMosi;                 //Byte shifted out so far
+static uint8_t UsiMiso;                 //Byte the slave is shifting back
+static HOSTSIM__SpiSlave_t SpiSlave;
+
+static bool Step(uint64_t limitPs);
+static void CheckInterrupts(void);
+
+//*****************************************************************************
+// Purpose: Leave HOSTSIM__Run, the CPU state is unwound to the main loop.
+// Argument: reason - Value returned by HOSTSIM__Run
+// Return: None
+//
+//*****************************************************************************
+
+static void ExitRun(int reason)
+{
+    if(NestingDepth > 0)
+    {
+        StatusRegister = StackedSR[0];
+        NestingDepth = 0;
+    }
+
+    StatusRegister &= ~(CPUOFF + OSCOFF + SCG0 + SCG1);
+    longjmp(RunExit, reason);
+}
+
+//*****************************************************************************
+// Purpose: Calculate the DCO frequency from the DCOCTL and BCSCTL1 settings.
+//          Modulation mixes the selected DCO step with the next one up.
+// Argument: dcoctl - DCOCTL register value
+//           bcsctl1 - BCSCTL1 register value
+// Return: DCO frequency in Hz
+//
+//*****************************************************************************
+
+static double DcoFrequency(uint8_t dcoctl, uint8_t bcsctl1)
+{
+    int rsel = bcsctl1 & 0x0F;
+    int dco = dcoctl >> 5;
+    int mod = dcoctl & 0x1F;
+    double hz = HOSTSIM__DCO_ANCHOR_HZ * pow(HOSTSIM__DCO_RSEL_STEP, rsel - 7) * pow(HOSTSIM__DCO_DCO_STEP, dco - 3);
+    double period;
+
+    if((dco < 7) && (mod != 0))
+    {
+        period = (((32 - mod) / hz) + (mod / (hz * HOSTSIM__DCO_DCO_STEP))) / 32;
+        hz = 1 / period;
+    }
+
+    return hz;
+}
+
+//*****************************************************************************
+// Purpose: Start or stop an oscillator, a started oscillator produces its
+//          first edge one period later.
+// Argument: osc - Oscillator
+//           running - New oscillator state
+// Return: None
+//
+//*****************************************************************************
+
+static void SetOscillator(Oscillator_t *osc, bool running)
+{
+    if(running && !osc->running)
+    {
+        osc->nextEdgePs = NowPs + osc->periodPs;
+    }
+
+    osc->running = running;
+}
+
+static void SetFrequency(Oscillator_t *osc, double hz)
+{
+    osc->hz = hz;
+    osc->periodPs = (uint64_t)((PS_PER_SECOND / hz) + 0.5);
+}
+
+//*****************************************************************************
+// Purpose: Apply the basic clock system registers and the status register
+//          clock bits to the oscillators and clock dividers.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void ClockConfig(void)
+{
+    uint8_t bcsctl1 = REG8(HOSTSIM__BCSCTL1_ADDR);
+    uint8_t bcsctl2 = REG8(HOSTSIM__BCSCTL2_ADDR);
+    uint8_t bcsctl3 = REG8(HOSTSIM__BCSCTL3_ADDR);
+    uint16_t dcoSetting = (REG8(HOSTSIM__DCOCTL_ADDR) << 8) | (bcsctl1 & 0x0F);
+    bool useVlo = (((bcsctl3 >> 4) & 3) == 2);
+    bool lfUsed;
+    bool dcoUsed;
+
+    if(dcoSetting != DcoSetting)
+    {
+        DcoSetting = dcoSetting;
+        SetFrequency(&Dco, DcoFrequency(REG8(HOSTSIM__DCOCTL_ADDR), bcsctl1));
+    }
+
+    //Crystal start up begins when LFXT1 is selected
+    if(useVlo)
+    {
+        CrystalStarted = false;
+        CrystalFault = false;
+        SetFrequency(&Lf, HOSTSIM__VLO_HZ);
+    }
+    else
+    {
+        if(!CrystalStarted)
+        {
+            CrystalStarted = true;
+            CrystalReadyPs = NowPs + (CrystalStartupUs * PS_PER_US);
+        }
+
+        CrystalFault = !CrystalPresent || (NowPs < CrystalReadyPs);
+        SetFrequency(&Lf, HOSTSIM__LFXT1_HZ);
+    }
+
+    if(CrystalFault)
+    {
+        REG8(HOSTSIM__BCSCTL3_ADDR) |= LFXT1OF;
+        REG8(HOSTSIM__IFG1_ADDR) |= OFIFG;
+    }
+    else
+    {
+        REG8(HOSTSIM__BCSCTL3_ADDR) &= ~LFXT1OF;
+    }
+
+    //MCLK fails safe to the DCO on an oscillator fault
+    MclkSource = (((bcsctl2 & (SELM0 + SELM1)) >= SELM_2) && !CrystalFault) ? CLOCK_LF : CLOCK_DCO;
+    SmclkSource = (bcsctl2 & SELS) ? CLOCK_LF : CLOCK_DCO;
+    MclkOn = !(StatusRegister & CPUOFF);
+    SmclkOn = !(StatusRegister & SCG1) && !((SmclkSource == CLOCK_LF) && CrystalFault);
+
+    MclkDivider = 1 << ((bcsctl2 >> 4) & 3);
+    SmclkDivider = 1 << ((bcsctl2 >> 1) & 3);
+    AclkDivider = 1 << ((bcsctl1 >> 4) & 3);
+
+    dcoUsed = (MclkOn && (MclkSource == CLOCK_DCO)) || (SmclkOn && (SmclkSource == CLOCK_DCO));
+    lfUsed = (MclkOn && (MclkSource == CLOCK_LF)) || (SmclkOn && (SmclkSource == CLOCK_LF));
+
+    SetOscillator(&Dco, !(StatusRegister & SCG0) || dcoUsed);
+    SetOscillator(&Lf, (!(StatusRegister & OSCOFF) || lfUsed) && !CrystalFault);
+}
+
+//*****************************************************************************
+// Purpose: Write a DTC result word to the simulated address space, mapped
+//          host buffers are written directly.
+// Argument: address - Simulated address
+//           value - Word to write
+// Return: None
+//
+//*****************************************************************************
+
+static void WriteData16(uint16_t address, uint16_t value)
+{
+    uint8_t index;
+    Mapping_t *map;
+
+    for(index = 0; index < NumMappings; index++)
+    {
+        map = &Mapping[index];
+
+        if((address >= map->address) && ((address - map->address + 2) <= map->size))
+        {
+            memcpy(&map->data[address - map->address], &value, sizeof(value));
+            return;
+        }
+    }
+
+    if(address < HOSTSIM__MEMORY_SIZE)
+    {
+        REG16(address) = value;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Start sampling the current ADC10 channel.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void AdcStartSample(void)
+{
+    static const uint8_t sampleClocks[] = {4, 8, 16, 64};
+    uint16_t ctl0 = REG16(HOSTSIM__ADC10CTL0_ADDR);
+    uint16_t ctl1 = REG16(HOSTSIM__ADC10CTL1_ADDR);
+
+    AdcState = ADC_SAMPLE;
+    AdcClocks = sampleClocks[(ctl0 >> 11) & 3];
+    REG16(HOSTSIM__ADC10CTL1_ADDR) = ctl1 | ADC10BUSY;
+    SetOscillator(&AdcOsc, ((ctl1 >> 3) & 3) == ADC_SOURCE_OSC);
+}
+
+static void AdcStop(void)
+{
+    AdcState = ADC_IDLE;
+    AdcSequence = false;
+    REG16(HOSTSIM__ADC10CTL1_ADDR) &= ~ADC10BUSY;
+    SetOscillator(&AdcOsc, false);
+}
+
+//*****************************************************************************
+// Purpose: Start a conversion on a sample trigger, ignored while a conversion
+//          is in progress.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void AdcTriggerConversion(void)
+{
+    uint16_t ctl0 = REG16(HOSTSIM__ADC10CTL0_ADDR);
+
+    if((ctl0 & ADC10ON) && (ctl0 & ENC) && (AdcState == ADC_IDLE))
+    {
+        if(!AdcSequence)
+        {
+            AdcChannel = REG16(HOSTSIM__ADC10CTL1_ADDR) >> 12;
+        }
+
+        AdcStartSample();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Store a conversion result through the data transfer controller.
+//          The interrupt flag is set when a block has been filled.
+// Argument: value - Conversion result
+// Return: None
+//
+//*****************************************************************************
+
+static void DtcTransfer(uint16_t value)
+{
+    uint8_t dtc0 = REG8(HOSTSIM__ADC10DTC0_ADDR);
+    uint8_t blockSize = REG8(HOSTSIM__ADC10DTC1_ADDR);
+    uint16_t address = REG16(HOSTSIM__ADC10SA_ADDR) + (2 * DtcIndex);
+
+    if(DtcSecondBlock)
+    {
+        address += 2 * blockSize;
+    }
+
+    WriteData16(address, value);
+    DtcIndex++;
+
+    if(DtcIndex >= blockSize)
+    {
+        DtcIndex = 0;
+        REG16(HOSTSIM__ADC10CTL0_ADDR) |= ADC10IFG;
+
+        if(dtc0 & ADC10TB)
+        {
+            //ADC10B1 is set when block one has been filled
+            if(!DtcSecondBlock)
+            {
+                REG8(HOSTSIM__ADC10DTC0_ADDR) |= ADC10B1;
+                DtcSecondBlock = true;
+                return;
+            }
+
+            REG8(HOSTSIM__ADC10DTC0_ADDR) &= ~ADC10B1;
+            DtcSecondBlock = false;
+        }
+
+        DtcActive = ((dtc0 & ADC10CT) != 0);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Complete the current conversion and move on to the next channel
+//          of the conversion sequence.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void AdcComplete(void)
+{
+    uint16_t ctl0 = REG16(HOSTSIM__ADC10CTL0_ADDR);
+    uint16_t ctl1 = REG16(HOSTSIM__ADC10CTL1_ADDR);
+    uint16_t value = AnalogInput[AdcChannel] & 0x03FF;
+    uint8_t inch = ctl1 >> 12;
+    bool enabled = ((ctl0 & ENC) != 0);
+    bool more = false;
+
+    //Two's complement results are left justified
+    if(ctl1 & ADC10DF)
+    {
+        value = (value ^ 0x0200) << 6;
+    }
+
+    REG16(HOSTSIM__ADC10MEM_ADDR) = value;
+
+    if(REG8(HOSTSIM__ADC10DTC1_ADDR) != 0)
+    {
+        if(DtcActive)
+        {
+            DtcTransfer(value);
+        }
+    }
+    else
+    {
+        REG16(HOSTSIM__ADC10CTL0_ADDR) |= ADC10IFG;
+    }
+
+    switch((ctl1 >> 1) & 3)
+    {
+        case 1:     //Sequence of channels, always runs to channel 0
+            if(AdcChannel > 0)
+            {
+                AdcChannel--;
+                more = true;
+            }
+            break;
+        case 2:     //Repeat single channel
+            more = enabled;
+            break;
+        case 3:     //Repeat sequence of channels
+            AdcChannel = (AdcChannel > 0) ? (AdcChannel - 1) : inch;
+            more = enabled;
+            break;
+        default:
+            break;
+    }
+
+    AdcState = ADC_IDLE;
+    SetOscillator(&AdcOsc, false);
+
+    if(more)
+    {
+        AdcSequence = true;
+        REG16(HOSTSIM__ADC10CTL1_ADDR) &= ~ADC10BUSY;
+
+        //Without MSC every conversion of the sequence needs a trigger
+        if(ctl0 & MSC)
+        {
+            AdcStartSample();
+        }
+    }
+    else
+    {
+        AdcStop();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Clock the ADC10 sample and conversion state machine.
+// Argument: source - Clock source of the edge, ADC10SSEL encoding
+// Return: None
+//
+//*****************************************************************************
+
+static void AdcClock(uint8_t source)
+{
+    uint16_t ctl1 = REG16(HOSTSIM__ADC10CTL1_ADDR);
+
+    if((AdcState == ADC_IDLE) || (((ctl1 >> 3) & 3) != source))
+    {
+        return;
+    }
+
+    if(++AdcCount <= ((ctl1 >> 5) & 7))
+    {
+        return;
+    }
+
+    AdcCount = 0;
+
+    if(--AdcClocks == 0)
+    {
+        if(AdcState == ADC_SAMPLE)
+        {
+            AdcState = ADC_CONVERT;
+            AdcClocks = ADC_CONVERT_CLOCKS;
+        }
+        else
+        {
+            AdcComplete();
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Timer_A capture on an input edge, sets COV if the previous
+//          capture has not been serviced.
+// Argument: channel - Capture/compare channel
+// Return: None
+//
+//*****************************************************************************
+
+static void TimerCapture(uint8_t channel)
+{
+    uint16_t cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+
+    if(cctl & CCIFG)
+    {
+        cctl |= COV;
+    }
+
+    REG16(HOSTSIM__TACCR0_ADDR + (2 * channel)) = REG16(HOSTSIM__TAR_ADDR);
+    REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel)) = cctl | CCIFG;
+}
+
+//*****************************************************************************
+// Purpose: Update the capture input level of a channel and capture on the
+//          edges selected by the capture mode.
+// Argument: channel - Capture/compare channel
+//           level - New input level
+// Return: None
+//
+//*****************************************************************************
+
+static void SetCaptureInput(uint8_t channel, bool level)
+{
+    uint16_t cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+    uint8_t mode = cctl >> 14;
+
+    if((level != CaptureInput[channel]) && (cctl & CAP))
+    {
+        if((level && (mode & 1)) || (!level && (mode & 2)))
+        {
+            TimerCapture(channel);
+            cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+        }
+    }
+
+    CaptureInput[channel] = level;
+    REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel)) = level ? (cctl | CCI) : (cctl & ~CCI);
+}
+
+//*****************************************************************************
+// Purpose: Update the capture inputs selected by CCIS. CCI0A and CCI1A are the
+//          P1.1 and P1.2 pins, CCI0B is ACLK and handled on the ACLK edge.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void UpdateCaptureInputs(void)
+{
+    static const uint8_t pinA[HOSTSIM__TIMERA_NUM_CCR] = {BIT1, BIT2};
+    uint8_t channel;
+    uint16_t cctl;
+
+    for(channel = 0; channel < HOSTSIM__TIMERA_NUM_CCR; channel++)
+    {
+        cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+
+        switch((cctl >> 12) & 3)
+        {
+            case 0:
+                SetCaptureInput(channel, (REG8(HOSTSIM__P1IN_ADDR) & pinA[channel]) != 0);
+                break;
+            case 2:
+                SetCaptureInput(channel, false);
+                break;
+            case 3:
+                SetCaptureInput(channel, true);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Update the Timer_A output units on a compare event and trigger the
+//          ADC10 on the selected output rising edge.
+// Argument: channel - Output unit
+//           equ - Timer counted to the channel compare value
+//           equ0 - Timer counted to TACCR0
+// Return: None
+//
+//*****************************************************************************
+
+static void TimerOutput(uint8_t channel, bool equ, bool equ0)
+{
+    uint16_t cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+    uint8_t mode = (cctl >> 5) & 7;
+    bool out = TimerOut[channel];
+    uint16_t ctl1;
+    uint8_t trigger;
+
+    if(mode == 0)
+    {
+        out = ((cctl & OUT) != 0);
+    }
+    else if(equ)
+    {
+        switch(mode)
+        {
+            case 1: case 3:
+                out = true;
+                break;
+            case 5: case 7:
+                out = false;
+                break;
+            default:
+                out = !out;
+                break;
+        }
+    }
+    else if(equ0 && (channel != 0))
+    {
+        if((mode == 2) || (mode == 3))
+        {
+            out = false;
+        }
+        else if((mode == 6) || (mode == 7))
+        {
+            out = true;
+        }
+    }
+
+    ctl1 = REG16(HOSTSIM__ADC10CTL1_ADDR);
+    trigger = (ctl1 >> 10) & 3;
+
+    //SHS 1 selects OUT1, SHS 2 selects OUT0
+    if((trigger != 0) && (trigger == (2 - channel)))
+    {
+        if(((ctl1 & ISSH) ? (TimerOut[channel] && !out) : (!TimerOut[channel] && out)))
+        {
+            AdcTriggerConversion();
+        }
+    }
+
+    TimerOut[channel] = out;
+}
+
+//*****************************************************************************
+// Purpose: Count Timer_A on a divided timer clock edge.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void TimerCountEdge(void)
+{
+    uint16_t tactl = REG16(HOSTSIM__TACTL_ADDR);
+    uint16_t tar = REG16(HOSTSIM__TAR_ADDR);
+    uint16_t ccr0 = REG16(HOSTSIM__TACCR0_ADDR);
+    uint16_t cctl;
+    uint8_t channel;
+    bool equ;
+    bool equ0;
+
+    switch((tactl >> 4) & 3)
+    {
+        case 1:     //Up mode
+            if(tar >= ccr0)
+            {
+                tar = 0;
+                tactl |= TAIFG;
+            }
+            else
+            {
+                tar++;
+            }
+            break;
+        case 2:     //Continuous mode
+            tar++;
+
+            if(tar == 0)
+            {
+                tactl |= TAIFG;
+            }
+            break;
+        case 3:     //Up/down mode
+            if(!TimerCountDown)
+            {
+                tar++;
+                TimerCountDown = (tar >= ccr0);
+            }
+            else if(tar > 0)
+            {
+                tar--;
+
+                if(tar == 0)
+                {
+                    tactl |= TAIFG;
+                    TimerCountDown = false;
+                }
+            }
+            break;
+        default:
+            return;
+    }
+
+    REG16(HOSTSIM__TAR_ADDR) = tar;
+    REG16(HOSTSIM__TACTL_ADDR) = tactl;
+    equ0 = (tar == ccr0);
+
+    for(channel = 0; channel < HOSTSIM__TIMERA_NUM_CCR; channel++)
+    {
+        cctl = REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel));
+        equ = !(cctl & CAP) && (tar == REG16(HOSTSIM__TACCR0_ADDR + (2 * channel)));
+
+        if(equ)
+        {
+            REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel)) = cctl | CCIFG;
+        }
+
+        TimerOutput(channel, equ, equ0);
+    }
+}
+
+static void TimerClock(uint8_t source)
+{
+    uint16_t tactl = REG16(HOSTSIM__TACTL_ADDR);
+
+    if(((tactl >> 8) & 3) == source)
+    {
+        if(++TimerCount >= (1 << ((tactl >> 6) & 3)))
+        {
+            TimerCount = 0;
+            TimerCountEdge();
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Clock the USI shift register in SPI master mode, one bit per
+//          divided clock. The slave is called once per byte with the byte
+//          shifted out and returns the byte it shifts back next.
+// Argument: source - Clock source of the edge, USISSEL encoding
+// Return: None
+//
+//*****************************************************************************
+
+static void UsiClock(uint8_t source)
+{
+    uint8_t ctl0 = REG8(HOSTSIM__USICTL0_ADDR);
+    uint8_t ckctl = REG8(HOSTSIM__USICKCTL_ADDR);
+    uint8_t cnt = REG8(HOSTSIM__USICNT_ADDR);
+    bool lsbFirst = ((ctl0 & USILSB) != 0);
+    uint16_t sr = REG16(HOSTSIM__USISRL_ADDR);
+    uint16_t msb = (cnt & USI16B) ? 0x8000 : 0x0080;
+    uint8_t ssel = (ckctl >> 2) & 7;
+    uint8_t in, out;
+
+    if(ssel == 3)
+    {
+        ssel = USI_CLOCK_SMCLK;
+    }
+
+    if((ctl0 & USISWRST) || !(ctl0 & USIMST) || (UsiCount == 0) || (ssel != source))
+    {
+        return;
+    }
+
+    if(++UsiDivCount < (1 << (ckctl >> 5)))
+    {
+        return;
+    }
+
+    UsiDivCount = 0;
+
+    out = lsbFirst ? (sr & 1) : ((sr & msb) != 0);
+    in = lsbFirst ? (UsiMiso & 1) : (UsiMiso >> 7);
+    UsiMiso = lsbFirst ? (UsiMiso >> 1) : (uint8_t)(UsiMiso << 1);
+
+    if(lsbFirst)
+    {
+        sr = (sr >> 1) | (in ? msb : 0);
+        UsiMosi = (UsiMosi >> 1) | (out << 7);
+    }
+    else
+    {
+        sr = (uint16_t)(sr << 1) | in;
+        UsiMosi = (uint8_t)(UsiMosi << 1) | out;
+    }
+
+    if(cnt & USI16B)
+    {
+        REG16(HOSTSIM__USISRL_ADDR) = sr;
+    }
+    else
+    {
+        REG8(HOSTSIM__USISRL_ADDR) = (uint8_t)sr;
+    }
+
+    if(++UsiBits == 8)
+    {
+        UsiBits = 0;
+        UsiMiso = (SpiSlave != 0) ? SpiSlave(UsiMosi) : 0xFF;
+    }
+
+    UsiCount--;
+    REG8(HOSTSIM__USICNT_ADDR) = (cnt & ~USICNT_BITS) | UsiCount;
+
+    if(UsiCount == 0)
+    {
+        REG8(HOSTSIM__USICTL1_ADDR) |= USIIFG;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Reset all peripheral registers to their power up clear values.
+// Argument: cause - IFG1 reset flags to set
+// Return: None
+//
+//*****************************************************************************
+
+static void ResetRegisters(uint8_t cause)
+{
+    uint8_t port;
+    uint16_t base;
+
+    REG8(HOSTSIM__IE1_ADDR) = 0;
+    REG8(HOSTSIM__IFG1_ADDR) |= (cause | OFIFG);
+
+    REG16(HOSTSIM__WDTCTL_ADDR) = WDTCTL_READ_KEY << 8;
+    WdtControl = 0;
+    WdtCount = 0;
+
+    REG8(HOSTSIM__DCOCTL_ADDR) = 0x60;
+    REG8(HOSTSIM__BCSCTL1_ADDR) = 0x87;
+    REG8(HOSTSIM__BCSCTL2_ADDR) = 0x00;
+    REG8(HOSTSIM__BCSCTL3_ADDR) = 0x05;
+    CrystalStarted = false;
+    MclkCount = 0;
+    SmclkCount = 0;
+    AclkCount = 0;
+
+    for(port = 0; port < NUM_PORTS; port++)
+    {
+        base = HOSTSIM__P1IN_ADDR + (port * (HOSTSIM__P2IN_ADDR - HOSTSIM__P1IN_ADDR));
+        REG8(base + HOSTSIM__PORT_DIR) = 0;
+        REG8(base + HOSTSIM__PORT_IFG) = 0;
+        REG8(base + HOSTSIM__PORT_IE) = 0;
+        REG8(base + HOSTSIM__PORT_SEL) = 0;
+        REG8(base + HOSTSIM__PORT_REN) = 0;
+    }
+
+    REG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_SEL) = BIT6 + BIT7;   //XIN and XOUT
+
+    REG16(HOSTSIM__TACTL_ADDR) = 0;
+    REG16(HOSTSIM__TAR_ADDR) = 0;
+    REG16(HOSTSIM__TAIV_ADDR) = 0;
+    memset(&REG16(HOSTSIM__TACCTL0_ADDR), 0, 2 * HOSTSIM__TIMERA_NUM_CCR);
+    memset(&REG16(HOSTSIM__TACCR0_ADDR), 0, 2 * HOSTSIM__TIMERA_NUM_CCR);
+    memset(TimerOut, 0, sizeof(TimerOut));
+    memset(CaptureInput, 0, sizeof(CaptureInput));
+    TimerCount = 0;
+    TimerCountDown = false;
+
+    REG16(HOSTSIM__ADC10CTL0_ADDR) = 0;
+    REG16(HOSTSIM__ADC10CTL1_ADDR) = 0;
+    REG16(HOSTSIM__ADC10SA_ADDR) = 0x0200;
+    REG8(HOSTSIM__ADC10DTC0_ADDR) = 0;
+    REG8(HOSTSIM__ADC10DTC1_ADDR) = 0;
+    REG8(HOSTSIM__ADC10AE0_ADDR) = 0;
+    AdcStop();
+    DtcRestart = false;
+    DtcActive = false;
+
+    REG16(HOSTSIM__FCTL1_ADDR) = 0x9600;
+    REG16(HOSTSIM__FCTL2_ADDR) = 0x9642;
+    REG16(HOSTSIM__FCTL3_ADDR) = 0x9658;
+
+    REG8(HOSTSIM__USICTL0_ADDR) = 0x01;
+    REG8(HOSTSIM__USICTL1_ADDR) = 0x01;
+    REG8(HOSTSIM__USICKCTL_ADDR) = 0x01;
+    REG8(HOSTSIM__USICNT_ADDR) = 0x00;
+    UsiCount = 0;
+    UsiDivCount = 0;
+    UsiBits = 0;
+    UsiMiso = 0xFF;
+
+    StatusRegister = 0;
+    NestingDepth = 0;
+    ClockConfig();
+}
+
+//*****************************************************************************
+// Purpose: Power up clear, triggered by the watchdog. Running code restarts
+//          from the HOSTSIM__Run entry function.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void WatchdogReset(void)
+{
+    ResetCount++;
+    ResetRegisters(WDTIFG);
+
+    if(Running)
+    {
+        longjmp(RunExit, RUN_RESET);
+    }
+}
+
+static void WatchdogClock(uint8_t source)
+{
+    static const uint16_t interval[] = {32768, 8192, 512, 64};
+
+    if((WdtControl & WDTHOLD) || (((WdtControl & WDTSSEL) ? 1 : 0) != source))
+    {
+        return;
+    }
+
+    if(++WdtCount >= interval[WdtControl & (WDTIS0 + WDTIS1)])
+    {
+        WdtCount = 0;
+
+        if(WdtControl & WDTTMSEL)
+        {
+            REG8(HOSTSIM__IFG1_ADDR) |= WDTIFG;
+        }
+        else
+        {
+            WatchdogReset();
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Update the port inputs from the simulated pin drive, outputs and
+//          pull resistors. Input edges set the port interrupt flags.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void UpdatePorts(void)
+{
+    uint8_t port;
+    uint16_t base;
+    uint8_t dir, out, input, previous, rising, falling;
+
+    for(port = 0; port < NUM_PORTS; port++)
+    {
+        base = HOSTSIM__P1IN_ADDR + (port * (HOSTSIM__P2IN_ADDR - HOSTSIM__P1IN_ADDR));
+        dir = REG8(base + HOSTSIM__PORT_DIR);
+        out = REG8(base + HOSTSIM__PORT_OUT);
+
+        //Undriven inputs follow the pull resistor, or read low when floating
+        input = (dir & out) | (~dir & ((PortDriveMask[port] & PortDriveLevel[port]) |
+                                       (~PortDriveMask[port] & REG8(base + HOSTSIM__PORT_REN) & out)));
+
+        previous = REG8(base);
+        rising = input & ~previous & ~REG8(base + HOSTSIM__PORT_IES);
+        falling = ~input & previous & REG8(base + HOSTSIM__PORT_IES);
+
+        REG8(base + HOSTSIM__PORT_IFG) |= (rising | falling);
+        REG8(base) = input;
+    }
+
+    UpdateCaptureInputs();
+}
+
+//*****************************************************************************
+// Purpose: Apply the side effects of register writes made since the last
+//          synchronisation.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Sync(void)
+{
+    uint16_t wdtctl = REG16(HOSTSIM__WDTCTL_ADDR);
+    uint16_t ctl0;
+    uint8_t channel;
+
+    //Watchdog writes must carry the password, reads return 0x69
+    if(((wdtctl >> 8) != WDTCTL_READ_KEY) || ((wdtctl & 0xFF) != WdtControl))
+    {
+        if((wdtctl >> 8) != WDTCTL_WRITE_KEY)
+        {
+            WatchdogReset();
+            return;
+        }
+
+        if(wdtctl & WDTCNTCL)
+        {
+            WdtCount = 0;
+        }
+
+        WdtControl = wdtctl & ~WDTCNTCL;
+        REG16(HOSTSIM__WDTCTL_ADDR) = (WDTCTL_READ_KEY << 8) | WdtControl;
+    }
+
+    if(REG16(HOSTSIM__TACTL_ADDR) & TACLR)
+    {
+        REG16(HOSTSIM__TACTL_ADDR) &= ~TACLR;
+        REG16(HOSTSIM__TAR_ADDR) = 0;
+        TimerCount = 0;
+        TimerCountDown = false;
+    }
+
+    for(channel = 0; channel < HOSTSIM__TIMERA_NUM_CCR; channel++)
+    {
+        if(((REG16(HOSTSIM__TACCTL0_ADDR + (2 * channel)) >> 5) & 7) == 0)
+        {
+            TimerOutput(channel, false, false);
+        }
+    }
+
+    ctl0 = REG16(HOSTSIM__ADC10CTL0_ADDR);
+
+    //Clearing ENC aborts a single conversion, sequences stop when complete
+    if(!(ctl0 & ADC10ON) || (!(ctl0 & ENC) && ((AdcState == ADC_IDLE) || (((REG16(HOSTSIM__ADC10CTL1_ADDR) >> 1) & 3) == 0))))
+    {
+        if((AdcState != ADC_IDLE) || AdcSequence)
+        {
+            AdcStop();
+        }
+    }
+
+    if(DtcRestart)
+    {
+        DtcRestart = false;
+        DtcActive = (REG8(HOSTSIM__ADC10DTC1_ADDR) != 0);
+        DtcIndex = 0;
+        DtcSecondBlock = false;
+    }
+
+    if(ctl0 & ADC10SC)
+    {
+        REG16(HOSTSIM__ADC10CTL0_ADDR) = ctl0 & ~ADC10SC;
+
+        if(((REG16(HOSTSIM__ADC10CTL1_ADDR) >> 10) & 3) == 0)
+        {
+            AdcTriggerConversion();
+        }
+    }
+
+    //Writing the bit counter clears USIIFG and starts the shift
+    if((REG8(HOSTSIM__USICNT_ADDR) & USICNT_BITS) != UsiCount)
+    {
+        UsiCount = REG8(HOSTSIM__USICNT_ADDR) & USICNT_BITS;
+
+        if(UsiCount != 0)
+        {
+            REG8(HOSTSIM__USICTL1_ADDR) &= ~USIIFG;
+        }
+    }
+
+    UpdatePorts();
+    ClockConfig();
+}
+
+//*****************************************************************************
+// Purpose: Clock edge handlers, each derived clock drives the peripherals
+//          selecting it.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void MclkEdge(void)
+{
+    if(++MclkCount >= MclkDivider)
+    {
+        MclkCount = 0;
+        Cycles++;
+        AdcClock(ADC_SOURCE_MCLK);
+    }
+}
+
+static void SmclkEdge(void)
+{
+    if(++SmclkCount >= SmclkDivider)
+    {
+        SmclkCount = 0;
+        TimerClock(TIMER_SOURCE_SMCLK);
+        WatchdogClock(0);
+        AdcClock(ADC_SOURCE_SMCLK);
+        UsiClock(USI_CLOCK_SMCLK);
+    }
+}
+
+static void AclkEdge(void)
+{
+    if(++AclkCount >= AclkDivider)
+    {
+        AclkCount = 0;
+        TimerClock(TIMER_SOURCE_ACLK);
+        WatchdogClock(1);
+        AdcClock(ADC_SOURCE_ACLK);
+        UsiClock(USI_CLOCK_ACLK);
+
+        //CCI0B is connected to ACLK, one capture per ACLK period
+        if((REG16(HOSTSIM__TACCTL0_ADDR) & (CAP + 0x3000)) == (CAP + 0x1000))
+        {
+            if(REG16(HOSTSIM__TACCTL0_ADDR) >> 14)
+            {
+                TimerCapture(0);
+            }
+        }
+    }
+}
+
+static void DcoEdge(void)
+{
+    if(MclkOn && (MclkSource == CLOCK_DCO))
+    {
+        MclkEdge();
+    }
+
+    if(SmclkOn && (SmclkSource == CLOCK_DCO))
+    {
+        SmclkEdge();
+    }
+}
+
+static void LfEdge(void)
+{
+    AclkEdge();
+
+    if(MclkOn && (MclkSource == CLOCK_LF))
+    {
+        MclkEdge();
+    }
+
+    if(SmclkOn && (SmclkSource == CLOCK_LF))
+    {
+        SmclkEdge();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Advance simulated time to the next oscillator edge or scheduled
+//          event. Leaves HOSTSIM__Run when its time limit is reached.
+// Argument: limitPs - Time not to step past
+// Return: False if no clock is running and no event is scheduled
+//
+//*****************************************************************************
+
+static bool Step(uint64_t limitPs)
+{
+    uint64_t next = NO_EDGE;
+    HOSTSIM__Event_t event;
+
+    if(Dco.running && (Dco.nextEdgePs < next))
+    {
+        next = Dco.nextEdgePs;
+    }
+
+    if(Lf.running && (Lf.nextEdgePs < next))
+    {
+        next = Lf.nextEdgePs;
+    }
+
+    if(AdcOsc.running && (AdcOsc.nextEdgePs < next))
+    {
+        next = AdcOsc.nextEdgePs;
+    }
+
+    if((NumEvents > 0) && (Event[0].timePs < next))
+    {
+        next = Event[0].timePs;
+    }
+
+    if(CrystalStarted && CrystalFault && CrystalPresent && (CrystalReadyPs < next))
+    {
+        next = CrystalReadyPs;
+    }
+
+    if(Running && (next > RunLimitPs))
+    {
+        NowPs = RunLimitPs;
+        ExitRun(HOSTSIM__RUN_TIME_LIMIT);
+    }
+
+    if(next > limitPs)
+    {
+        next = limitPs;
+    }
+
+    if(next == NO_EDGE)
+    {
+        return false;
+    }
+
+    NowPs = next;
+
+    if(Dco.running && (Dco.nextEdgePs == next))
+    {
+        Dco.nextEdgePs += Dco.periodPs;
+        DcoEdge();
+    }
+
+    if(Lf.running && (Lf.nextEdgePs == next))
+    {
+        Lf.nextEdgePs += Lf.periodPs;
+        LfEdge();
+    }
+
+    if(AdcOsc.running && (AdcOsc.nextEdgePs == next))
+    {
+        AdcOsc.nextEdgePs += AdcOsc.periodPs;
+        AdcClock(ADC_SOURCE_OSC);
+    }
+
+    if((NumEvents > 0) && (Event[0].timePs == next))
+    {
+        event = Event[0].event;
+        NumEvents--;
+        memmove(&Event[0], &Event[1], NumEvents * sizeof(Event_t));
+        event();
+    }
+
+    if(CrystalStarted && CrystalFault && (NowPs >= CrystalReadyPs))
+    {
+        ClockConfig();
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Run the CPU for a number of MCLK cycles.
+// Argument: cycles - MCLK cycles
+// Return: None
+//
+//*****************************************************************************
+
+static void AdvanceCycles(uint32_t cycles)
+{
+    uint64_t target = Cycles + cycles;
+
+    Sync();
+
+    //Stops early when no clock is running
+    while((Cycles < target) && Step(NO_EDGE))
+    {
+    }
+}
+
+//*****************************************************************************
+// Purpose: Return the highest priority pending interrupt vector which has a
+//          handler installed.
+// Argument: None
+// Return: Vector number, 0 when no interrupt is pending
+//
+//*****************************************************************************
+
+static uint8_t PendingVector(void)
+{
+    uint8_t ie1 = REG8(HOSTSIM__IE1_ADDR);
+    uint8_t ifg1 = REG8(HOSTSIM__IFG1_ADDR);
+    uint16_t tactl = REG16(HOSTSIM__TACTL_ADDR);
+    uint16_t ctl0 = REG16(HOSTSIM__ADC10CTL0_ADDR);
+    uint8_t vector = 0;
+
+    if((ie1 & OFIE) && (ifg1 & OFIFG) && Vector[NMI_VECTOR])
+    {
+        vector = NMI_VECTOR;
+    }
+    else if(!(StatusRegister & GIE))
+    {
+        vector = 0;
+    }
+    else if((ie1 & WDTIE) && (ifg1 & WDTIFG) && (WdtControl & WDTTMSEL) && Vector[WDT_VECTOR])
+    {
+        vector = WDT_VECTOR;
+    }
+    else if(((REG16(HOSTSIM__TACCTL0_ADDR) & (CCIE + CCIFG)) == (CCIE + CCIFG)) && Vector[TIMERA0_VECTOR])
+    {
+        vector = TIMERA0_VECTOR;
+    }
+    else if((((REG16(HOSTSIM__TACCTL0_ADDR + 2) & (CCIE + CCIFG)) == (CCIE + CCIFG)) ||
+             ((tactl & (TAIE + TAIFG)) == (TAIE + TAIFG))) && Vector[TIMERA1_VECTOR])
+    {
+        vector = TIMERA1_VECTOR;
+    }
+    else if(((ctl0 & (ADC10IE + ADC10IFG)) == (ADC10IE + ADC10IFG)) && Vector[ADC10_VECTOR])
+    {
+        vector = ADC10_VECTOR;
+    }
+    else if(((REG8(HOSTSIM__USICTL1_ADDR) & (USIIE + USIIFG)) == (USIIE + USIIFG)) && Vector[USI_VECTOR])
+    {
+        vector = USI_VECTOR;
+    }
+    else if((REG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_IFG) & REG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_IE)) && Vector[PORT2_VECTOR])
+    {
+        vector = PORT2_VECTOR;
+    }
+    else if((REG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_IFG) & REG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_IE)) && Vector[PORT1_VECTOR])
+    {
+        vector = PORT1_VECTOR;
+    }
+
+    return vector;
+}
+
+//*****************************************************************************
+// Purpose: Accept an interrupt. Single source flags are cleared as on the
+//          device, the status register is stacked and cleared except SCG0.
+// Argument: vector - Vector number
+// Return: None
+//
+//*****************************************************************************
+
+static void Dispatch(uint8_t vector)
+{
+    HOSTSIM__VectorStats_t *stats = &VectorStats[vector];
+    uint64_t start = Cycles;
+    uint32_t cycles;
+
+    switch(vector)
+    {
+        case NMI_VECTOR:
+            REG8(HOSTSIM__IE1_ADDR) &= ~(OFIE + NMIIE + ACCVIE);
+            break;
+        case WDT_VECTOR:
+            REG8(HOSTSIM__IFG1_ADDR) &= ~WDTIFG;
+            break;
+        case TIMERA0_VECTOR:
+            REG16(HOSTSIM__TACCTL0_ADDR) &= ~CCIFG;
+            break;
+        case ADC10_VECTOR:
+            REG16(HOSTSIM__ADC10CTL0_ADDR) &= ~ADC10IFG;
+            break;
+        default:
+            break;
+    }
+
+    StackedSR[NestingDepth++] = StatusRegister;
+    StatusRegister &= SCG0;
+    AdvanceCycles(HOSTSIM__INTERRUPT_ENTRY_CYCLES);
+
+    Vector[vector]();
+
+    AdvanceCycles(HOSTSIM__INTERRUPT_RETURN_CYCLES);
+    StatusRegister = StackedSR[--NestingDepth];
+    ClockConfig();
+
+    cycles = (uint32_t)(Cycles - start);
+    stats->count++;
+    stats->cycles += cycles;
+
+    if((stats->count == 1) || (cycles < stats->minCycles))
+    {
+        stats->minCycles = cycles;
+    }
+
+    if(cycles > stats->maxCycles)
+    {
+        stats->maxCycles = cycles;
+    }
+}
+
+static void CheckInterrupts(void)
+{
+    uint8_t vector;
+
+    while(((vector = PendingVector()) != 0) && (NestingDepth < HOSTSIM__MAX_NESTING))
+    {
+        Dispatch(vector);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Register access, charges the access cycles, dispatches pending
+//          interrupts and applies read side effects.
+// Argument: address - Register address
+// Return: Byte offset into the register file, HOSTSIM__MEMORY_SIZE when out of
+//         range
+//
+//*****************************************************************************
+
+static uint16_t Access(uint16_t address, uint8_t size)
+{
+    uint16_t taiv = TAIV_NONE;
+
+    AdvanceCycles(HOSTSIM__ACCESS_CYCLES);
+    CheckInterrupts();
+
+    if((uint32_t)(address + size) > HOSTSIM__MEMORY_SIZE)
+    {
+        return HOSTSIM__MEMORY_SIZE;
+    }
+
+    //Reading TAIV returns and clears the highest priority enabled Timer_A flag
+    if(address == HOSTSIM__TAIV_ADDR)
+    {
+        if((REG16(HOSTSIM__TACCTL0_ADDR + 2) & (CCIE + CCIFG)) == (CCIE + CCIFG))
+        {
+            REG16(HOSTSIM__TACCTL0_ADDR + 2) &= ~CCIFG;
+            taiv = TAIV_TACCR1;
+        }
+        else if((REG16(HOSTSIM__TACTL_ADDR) & (TAIE + TAIFG)) == (TAIE + TAIFG))
+        {
+            REG16(HOSTSIM__TACTL_ADDR) &= ~TAIFG;
+            taiv = TAIV_TAIFG;
+        }
+
+        REG16(HOSTSIM__TAIV_ADDR) = taiv;
+    }
+
+    //The dummy write starting a segment erase is discarded, the CPU is held
+    //for the erase time
+    if((address >= HOSTSIM__INFO_BASE) && (REG16(HOSTSIM__FCTL1_ADDR) & ERASE) && !(REG16(HOSTSIM__FCTL3_ADDR) & LOCK))
+    {
+        memset(&REG8(address & ~(HOSTSIM__INFO_SEGMENT_SIZE - 1)), 0xFF, HOSTSIM__INFO_SEGMENT_SIZE);
+        REG16(HOSTSIM__FCTL1_ADDR) &= ~ERASE;
+        AdvanceCycles(HOSTSIM__FLASH_ERASE_FTG_CYCLES * ((REG16(HOSTSIM__FCTL2_ADDR) & 0x3F) + 1));
+
+        return HOSTSIM__MEMORY_SIZE;
+    }
+
+    //Writing ADC10SA starts the data transfer controller
+    if(address == HOSTSIM__ADC10SA_ADDR)
+    {
+        DtcRestart = true;
+    }
+
+    return address;
+}
+
+//*****************************************************************************
+// Purpose: Register accessors used by the HWREG macros. Word accesses ignore
+//          the lowest address bit as on the device.
+// Argument: address - Register address
+// Return: Pointer to the simulated register
+//
+//*****************************************************************************
+
+volatile uint8_t *HOSTSIM__Register8(uint16_t address)
+{
+    address = Access(address, 1);
+
+    return (address < HOSTSIM__MEMORY_SIZE) ? &REG8(address) : (uint8_t *)BadAccess;
+}
+
+volatile uint16_t *HOSTSIM__Register16(uint16_t address)
+{
+    address = Access(address & ~1, 2);
+
+    return (address < HOSTSIM__MEMORY_SIZE) ? &REG16(address) : (uint16_t *)BadAccess;
+}
+
+volatile uint32_t *HOSTSIM__Register32(uint16_t address)
+{
+    address = Access(address & ~1, 4);
+
+    return (address < HOSTSIM__MEMORY_SIZE) ? (uint32_t *)&REG16(address) : BadAccess;
+}
+
+//*****************************************************************************
+// Purpose: Map a host buffer into the simulated address space so it can be
+//          used as a DMA target, such as the ADC10 data transfer controller.
+// Argument: data - Host buffer
+//           size - Buffer size in bytes
+// Return: Simulated address of the buffer, 0 if the map is full
+//
+//*****************************************************************************
+
+uint16_t HOSTSIM__MapAddress(void *data, uint16_t size)
+{
+    uint8_t index;
+    uint16_t address = 0;
+
+    for(index = 0; index < NumMappings; index++)
+    {
+        if((Mapping[index].data == data) && (Mapping[index].size >= size))
+        {
+            return Mapping[index].address;
+        }
+    }
+
+    if((NumMappings < HOSTSIM__MAX_MAPPINGS) && ((NextMapAddress + size) <= HOSTSIM__MAP_END))
+    {
+        address = NextMapAddress;
+        Mapping[NumMappings].address = address;
+        Mapping[NumMappings].size = size;
+        Mapping[NumMappings].data = data;
+        NumMappings++;
+        NextMapAddress = (NextMapAddress + size + 1) & ~1;
+    }
+
+    return address;
+}
+
+//*****************************************************************************
+// Purpose: Status register intrinsics. Setting CPUOFF sleeps until an
+//          interrupt handler clears it on exit.
+// Argument: bits - Status register bits
+// Return: None
+//
+//*****************************************************************************
+
+void HOSTSIM__BisSR(uint16_t bits)
+{
+    Sync();
+    StatusRegister |= bits;
+    ClockConfig();
+    CheckInterrupts();
+
+    while(StatusRegister & CPUOFF)
+    {
+        //Nothing can wake the CPU, outside HOSTSIM__Run
+        if(!Step(NO_EDGE))
+        {
+            StatusRegister &= ~(CPUOFF + OSCOFF + SCG0 + SCG1);
+            ClockConfig();
+            break;
+        }
+
+        CheckInterrupts();
+    }
+}
+
+void HOSTSIM__BicSR(uint16_t bits)
+{
+    Sync();
+    StatusRegister &= ~bits;
+    ClockConfig();
+}
+
+void HOSTSIM__BisSROnExit(uint16_t bits)
+{
+    if(NestingDepth > 0)
+    {
+        StackedSR[NestingDepth - 1] |= bits;
+    }
+}
+
+void HOSTSIM__BicSROnExit(uint16_t bits)
+{
+    if(NestingDepth > 0)
+    {
+        StackedSR[NestingDepth - 1] &= ~bits;
+    }
+}
+
+uint16_t HOSTSIM__GetSR(void)
+{
+    return StatusRegister;
+}
+
+void HOSTSIM__Delay(uint32_t cycles)
+{
+    AdvanceCycles(cycles);
+    CheckInterrupts();
+}
+
+//*****************************************************************************
+// Purpose: Power on the simulated device. The register file is cleared, the
+//          DCO calibration data is generated from the oscillator model and the
+//          default interrupt handlers are installed.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void HOSTSIM__PowerOn(void)
+{
+    double error;
+    double bestError = PS_PER_SECOND;
+    uint16_t setting;
+    uint8_t dcoctl;
+    uint8_t rsel;
+
+    memset(&Memory, 0, sizeof(Memory));
+    memset(&Memory.byte[0x1000], 0xFF, HOSTSIM__MEMORY_SIZE - 0x1000);   //Erased information memory
+    memset(Vector, 0, sizeof(Vector));
+    memset(VectorStats, 0, sizeof(VectorStats));
+    memset(AnalogInput, 0, sizeof(AnalogInput));
+    memset(PortDriveMask, 0, sizeof(PortDriveMask));
+    memset(&Dco, 0, sizeof(Dco));
+    memset(&Lf, 0, sizeof(Lf));
+
+    //Factory calibration, closest setting to the target frequency
+    for(setting = 0; setting < 0x1000; setting++)
+    {
+        dcoctl = setting & 0xFF;
+        rsel = setting >> 8;
+        error = fabs(DcoFrequency(dcoctl, rsel) - HOSTSIM__CAL_1MHZ_TARGET_HZ);
+
+        if(error < bestError)
+        {
+            bestError = error;
+            REG8(HOSTSIM__CALDCO_1MHZ_ADDR) = dcoctl;
+            REG8(HOSTSIM__CALBC1_1MHZ_ADDR) = XT2OFF + rsel;
+        }
+    }
+
+    Vector[PORT1_VECTOR] = GPIO_PORT1_Handler;
+    Vector[PORT2_VECTOR] = GPIO_PORT2_Handler;
+    Vector[TIMERA1_VECTOR] = TIMERA1_HANDLER;
+    Vector[TIMERA0_VECTOR] = TIMERA0_HANDLER;
+    Vector[NMI_VECTOR] = NMI_HANDLER;
+    Vector[WDT_VECTOR] = WDT_HANDLER;
+    Vector[ADC10_VECTOR] = ADC10_HANDLER;
+    Vector[USI_VECTOR] = USI_HANDLER;
+
+    AnalogInput[10] = 0x0300;           //Temperature sensor
+    AnalogInput[11] = 0x0200;           //(VCC - VSS) / 2
+
+    NowPs = 0;
+    Cycles = 0;
+    ResetCount = 0;
+    NumEvents = 0;
+    NumMappings = 0;
+    NextMapAddress = HOSTSIM__MAP_BASE;
+    CrystalPresent = true;
+    CrystalStartupUs = HOSTSIM__LFXT1_STARTUP_US;
+    DcoSetting = 0xFFFF;
+
+    SetFrequency(&AdcOsc, HOSTSIM__ADC10OSC_HZ);
+    REG8(HOSTSIM__IFG1_ADDR) = 0;
+    ResetRegisters(PORIFG);
+}
+
+//*****************************************************************************
+// Purpose: Run code on the simulated device for a length of simulated time.
+//          The entry function is restarted after a watchdog reset.
+// Argument: entry - Function to run, such as the application main loop
+//           microseconds - Simulated time limit
+// Return: HOSTSIM__RUN_TIME_LIMIT or HOSTSIM__RUN_RETURNED
+//
+//*****************************************************************************
+
+int HOSTSIM__Run(HOSTSIM__Vector_t entry, uint32_t microseconds)
+{
+    int status = HOSTSIM__RUN_TIME_LIMIT;
+
+    RunLimitPs = NowPs + (microseconds * PS_PER_US);
+    Running = true;
+
+    switch(setjmp(RunExit))
+    {
+        case 0:
+        case RUN_RESET:
+            entry();
+            status = HOSTSIM__RUN_RETURNED;
+            break;
+        default:
+            break;
+    }
+
+    Running = false;
+
+    return status;
+}
+
+//*****************************************************************************
+// Purpose: Let simulated time pass with the CPU idle, enabled interrupts are
+//          serviced.
+// Argument: microseconds - Simulated time
+// Return: None
+//
+//*****************************************************************************
+
+void HOSTSIM__Idle(uint32_t microseconds)
+{
+    uint64_t target = NowPs + (microseconds * PS_PER_US);
+
+    Sync();
+
+    while((NowPs < target) && Step(target))
+    {
+        CheckInterrupts();
+    }
+}
+
+void HOSTSIM__SetVector(uint8_t vector, HOSTSIM__Vector_t handler)
+{
+    if(vector < HOSTSIM__NUM_VECTORS)
+    {
+        Vector[vector] = handler;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Schedule a stimulus function, called from simulated time.
+// Argument: microseconds - Delay from the current simulated time
+//           event - Function to call
+// Return: False if the event queue is full
+//
+//*****************************************************************************
+
+bool HOSTSIM__ScheduleEvent(uint32_t microseconds, HOSTSIM__Event_t event)
+{
+    uint64_t timePs = NowPs + (microseconds * PS_PER_US);
+    uint8_t index;
+
+    if(NumEvents >= HOSTSIM__MAX_EVENTS)
+    {
+        return false;
+    }
+
+    for(index = NumEvents; (index > 0) && (Event[index - 1].timePs > timePs); index--)
+    {
+        Event[index] = Event[index - 1];
+    }
+
+    Event[index].timePs = timePs;
+    Event[index].event = event;
+    NumEvents++;
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Drive the pins of a simulated port from outside the device.
+// Argument: port - Port number, 1 or 2
+//           driveMask - Pins driven externally, other pins are released
+//           level - Level of the driven pins
+// Return: None
+//
+//*****************************************************************************
+
+void HOSTSIM__SetPortInput(uint8_t port, uint8_t driveMask, uint8_t level)
+{
+    if((port >= 1) && (port <= NUM_PORTS))
+    {
+        PortDriveMask[port - 1] = driveMask;
+        PortDriveLevel[port - 1] = level;
+        UpdatePorts();
+    }
+}
+
+void HOSTSIM__SetAnalogInput(uint8_t channel, uint16_t value)
+{
+    if(channel < HOSTSIM__NUM_ANALOG_CHANNELS)
+    {
+        AnalogInput[channel] = value;
+    }
+}
+
+void HOSTSIM__SetSpiSlave(HOSTSIM__SpiSlave_t slave)
+{
+    SpiSlave = slave;
+}
+
+uint8_t HOSTSIM__GetPortOutput(uint8_t port)
+{
+    if((port >= 1) && (port <= NUM_PORTS))
+    {
+        return REG8(HOSTSIM__P1IN_ADDR + ((port - 1) * (HOSTSIM__P2IN_ADDR - HOSTSIM__P1IN_ADDR)) + HOSTSIM__PORT_OUT);
+    }
+
+    return 0;
+}
+
+void HOSTSIM__SetCrystal(bool present, uint32_t startupMicroseconds)
+{
+    CrystalPresent = present;
+    CrystalStartupUs = startupMicroseconds;
+    CrystalStarted = false;
+    ClockConfig();
+}
+
+uint64_t HOSTSIM__GetCycles(void)
+{
+    return Cycles;
+}
+
+uint64_t HOSTSIM__GetTimeNs(void)
+{
+    return NowPs / PS_PER_NS;
+}
+
+uint32_t HOSTSIM__GetResetCount(void)
+{
+    return ResetCount;
+}
+
+double HOSTSIM__GetDcoFrequency(void)
+{
+    return Dco.hz;
+}
+
+void HOSTSIM__GetVectorStats(uint8_t vector, HOSTSIM__VectorStats_t *stats)
+{
+    if(vector < HOSTSIM__NUM_VECTORS)
+    {
+        *stats = VectorStats[vector];
+    }
+}
+
+void HOSTSIM__ClearVectorStats(void)
+{
+    memset(VectorStats, 0, sizeof(VectorStats));
+}
@@ -0,0 +1,154 @@
+// *****************************************************************************
+// *  File: hostsim.h
+// *
+// *  Purpose:
+// *  This is the header file for the host register simulator. When MYLIB is
+// *  compiled with MYLIB_HOST_SIM defined, the HWREG macros and the CPU
+// *  intrinsics resolve into a simulated MSP430G2231 register file so the
+// *  drivers can be run and benchmarked on a desktop machine.
+// *
+// *  Timer_A, ports 1 and 2, the basic clock system, ADC10, the USI in SPI
+// *  master mode and the watchdog are modelled on an event driven clock. Time only advances when the code
+// *  accesses a register, delays or sleeps, every register access is charged
+// *  HOSTSIM__ACCESS_CYCLES MCLK cycles. Interrupt vectors are dispatched
+// *  between register accesses when enabled, with the hardware entry and
+// *  return latency.
+// *
+// *  Host build: compile the MYLIB sources and HOST_SIM/hostsim.c with
+// *  -DMYLIB_HOST_SIM -IHOST_SIM -Wno-unknown-pragmas and link with -lm. The
+// *  HOST_SIM directory provides the in430.h and intrinsics.h replacements.
+// *  The MYLIB Makefile does so and runs the test programs in TESTS.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _HOSTSIM_H_
+#define _HOSTSIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_HOSTSIM
+
+//*****************************************************************************
+//
+// Simulator configuration constants defined here
+//
+//*****************************************************************************
+
+//Simulated address space, covers the peripherals, RAM and information memory
+#define HOSTSIM__MEMORY_SIZE                0x1100
+
+//Window of the address space handed out by HOSTSIM__MapAddress
+#define HOSTSIM__MAP_BASE                   0x0200
+#define HOSTSIM__MAP_END                    0x1000
+#define HOSTSIM__MAX_MAPPINGS               8
+
+//MCLK cycles charged for each register access, absolute addressing mode
+#define HOSTSIM__ACCESS_CYCLES              4
+
+//MCLK cycles charged for interrupt entry and RETI
+#define HOSTSIM__INTERRUPT_ENTRY_CYCLES     6
+#define HOSTSIM__INTERRUPT_RETURN_CYCLES    5
+
+//Oscillator model, DCO frequency is anchored at RSEL 7 DCO 3 MOD 0
+#define HOSTSIM__DCO_ANCHOR_HZ              1100000.0
+#define HOSTSIM__DCO_RSEL_STEP              1.35
+#define HOSTSIM__DCO_DCO_STEP               1.08
+#define HOSTSIM__LFXT1_HZ                   32768.0
+#define HOSTSIM__VLO_HZ                     12000.0
+#define HOSTSIM__ADC10OSC_HZ                5000000.0
+
+//Frequency the factory calibration data is generated for
+#define HOSTSIM__CAL_1MHZ_TARGET_HZ         1000000.0
+
+//Information memory, a segment erase is modelled, programming is not
+//restricted to clearing bits
+#define HOSTSIM__INFO_BASE                  0x1000
+#define HOSTSIM__INFO_SEGMENT_SIZE          64
+#define HOSTSIM__FLASH_ERASE_FTG_CYCLES     4819
+
+//Default crystal start up time after LFXT1 is selected
+#define HOSTSIM__LFXT1_STARTUP_US           1000
+
+#define HOSTSIM__NUM_VECTORS                16
+#define HOSTSIM__MAX_NESTING                8
+#define HOSTSIM__MAX_EVENTS                 16
+#define HOSTSIM__NUM_ANALOG_CHANNELS        16
+
+//Timer_A2 on the MSP430G2231 has two capture/compare channels
+#define HOSTSIM__TIMERA_NUM_CCR             2
+
+//HOSTSIM__Run return values
+#define HOSTSIM__RUN_TIME_LIMIT             1
+#define HOSTSIM__RUN_RETURNED               2
+
+//*****************************************************************************
+//
+// Simulator data types defined here
+//
+//*****************************************************************************
+
+typedef void (*HOSTSIM__Vector_t)(void);
+typedef void (*HOSTSIM__Event_t)(void);
+
+//SPI slave on the USI, called from the simulated clock once per byte shifted
+//out. Returns the byte to shift back with the next byte, like a slave
+//loading its shift register. Must not access registers.
+typedef uint8_t (*HOSTSIM__SpiSlave_t)(uint8_t mosi);
+
+//Time spent in an interrupt vector, entry and return latency included
+typedef struct {
+    uint32_t count;
+    uint64_t cycles;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+} HOSTSIM__VectorStats_t;
+
+//*****************************************************************************
+//
+// Register and CPU access, used by the HWREG macros and host intrinsics
+//
+//*****************************************************************************
+
+volatile uint8_t *HOSTSIM__Register8(uint16_t address);
+volatile uint16_t *HOSTSIM__Register16(uint16_t address);
+volatile uint32_t *HOSTSIM__Register32(uint16_t address);
+uint16_t HOSTSIM__MapAddress(void *data, uint16_t size);
+
+void HOSTSIM__BisSR(uint16_t bits);
+void HOSTSIM__BicSR(uint16_t bits);
+void HOSTSIM__BisSROnExit(uint16_t bits);
+void HOSTSIM__BicSROnExit(uint16_t bits);
+uint16_t HOSTSIM__GetSR(void);
+void HOSTSIM__Delay(uint32_t cycles);
+
+//*****************************************************************************
+//
+// Simulation control, used by host test and benchmark programs
+//
+//*****************************************************************************
+
+void HOSTSIM__PowerOn(void);
+int HOSTSIM__Run(HOSTSIM__Vector_t entry, uint32_t microseconds);
+void HOSTSIM__Idle(uint32_t microseconds);
+void HOSTSIM__SetVector(uint8_t vector, HOSTSIM__Vector_t handler);
+bool HOSTSIM__ScheduleEvent(uint32_t microseconds, HOSTSIM__Event_t event);
+void HOSTSIM__SetPortInput(uint8_t port, uint8_t driveMask, uint8_t level);
+void HOSTSIM__SetAnalogInput(uint8_t channel, uint16_t value);
+void HOSTSIM__SetSpiSlave(HOSTSIM__SpiSlave_t slave);
+uint8_t HOSTSIM__GetPortOutput(uint8_t port);
+void HOSTSIM__SetCrystal(bool present, uint32_t startupMicroseconds);
+uint64_t HOSTSIM__GetCycles(void);
+uint64_t HOSTSIM__GetTimeNs(void);
+uint32_t HOSTSIM__GetResetCount(void);
+double HOSTSIM__GetDcoFrequency(void);
+void HOSTSIM__GetVectorStats(uint8_t vector, HOSTSIM__VectorStats_t *stats);
+void HOSTSIM__ClearVectorStats(void);
+
+#endif //_HOSTSIM_H_
@@ -0,0 +1,126 @@
+// *****************************************************************************
+// *  File: hostsim_sfr.h
+// *
+// *  Purpose:
+// *  Register addresses of the simulated MSP430G2231 peripherals. The named
+// *  special function registers of the device header are remapped onto the
+// *  simulated register file, included after the device header.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _HOSTSIM_SFR_H_
+#define _HOSTSIM_SFR_H_
+
+//*****************************************************************************
+//
+// Peripheral register addresses defined here
+//
+//*****************************************************************************
+
+#define HOSTSIM__IE1_ADDR                   0x0000
+#define HOSTSIM__IFG1_ADDR                  0x0002
+#define HOSTSIM__ADC10DTC0_ADDR             0x0048
+#define HOSTSIM__ADC10DTC1_ADDR             0x0049
+#define HOSTSIM__ADC10AE0_ADDR              0x004A
+#define HOSTSIM__BCSCTL3_ADDR               0x0053
+#define HOSTSIM__DCOCTL_ADDR                0x0056
+#define HOSTSIM__BCSCTL1_ADDR               0x0057
+#define HOSTSIM__BCSCTL2_ADDR               0x0058
+#define HOSTSIM__P1IN_ADDR                  0x0020
+#define HOSTSIM__P2IN_ADDR                  0x0028
+#define HOSTSIM__USICTL0_ADDR               0x0078
+#define HOSTSIM__USICTL1_ADDR               0x0079
+#define HOSTSIM__USICKCTL_ADDR              0x007A
+#define HOSTSIM__USICNT_ADDR                0x007B
+#define HOSTSIM__USISRL_ADDR                0x007C
+#define HOSTSIM__USISRH_ADDR                0x007D
+#define HOSTSIM__WDTCTL_ADDR                0x0120
+#define HOSTSIM__FCTL1_ADDR                 0x0128
+#define HOSTSIM__FCTL2_ADDR                 0x012A
+#define HOSTSIM__FCTL3_ADDR                 0x012C
+#define HOSTSIM__TAIV_ADDR                  0x012E
+#define HOSTSIM__TACTL_ADDR                 0x0160
+#define HOSTSIM__TACCTL0_ADDR               0x0162
+#define HOSTSIM__TAR_ADDR                   0x0170
+#define HOSTSIM__TACCR0_ADDR                0x0172
+#define HOSTSIM__ADC10CTL0_ADDR             0x01B0
+#define HOSTSIM__ADC10CTL1_ADDR             0x01B2
+#define HOSTSIM__ADC10MEM_ADDR              0x01B4
+#define HOSTSIM__ADC10SA_ADDR               0x01BC
+#define HOSTSIM__CALDCO_1MHZ_ADDR           0x10FE
+#define HOSTSIM__CALBC1_1MHZ_ADDR           0x10FF
+
+//Port register offsets from the PxIN address
+#define HOSTSIM__PORT_OUT                   1
+#define HOSTSIM__PORT_DIR                   2
+#define HOSTSIM__PORT_IFG                   3
+#define HOSTSIM__PORT_IES                   4
+#define HOSTSIM__PORT_IE                    5
+#define HOSTSIM__PORT_SEL                   6
+#define HOSTSIM__PORT_REN                   7
+
+//*****************************************************************************
+//
+// Named special function registers remapped here
+//
+//*****************************************************************************
+
+#define IE1                 HWREG8(HOSTSIM__IE1_ADDR)
+#define IFG1                HWREG8(HOSTSIM__IFG1_ADDR)
+#define ADC10DTC0           HWREG8(HOSTSIM__ADC10DTC0_ADDR)
+#define ADC10DTC1           HWREG8(HOSTSIM__ADC10DTC1_ADDR)
+#define ADC10AE0            HWREG8(HOSTSIM__ADC10AE0_ADDR)
+#define ADC10CTL0           HWREG16(HOSTSIM__ADC10CTL0_ADDR)
+#define ADC10CTL1           HWREG16(HOSTSIM__ADC10CTL1_ADDR)
+#define ADC10MEM            HWREG16(HOSTSIM__ADC10MEM_ADDR)
+#define ADC10SA             HWREG16(HOSTSIM__ADC10SA_ADDR)
+#define DCOCTL              HWREG8(HOSTSIM__DCOCTL_ADDR)
+#define BCSCTL1             HWREG8(HOSTSIM__BCSCTL1_ADDR)
+#define BCSCTL2             HWREG8(HOSTSIM__BCSCTL2_ADDR)
+#define BCSCTL3             HWREG8(HOSTSIM__BCSCTL3_ADDR)
+#define FCTL1               HWREG16(HOSTSIM__FCTL1_ADDR)
+#define FCTL2               HWREG16(HOSTSIM__FCTL2_ADDR)
+#define FCTL3               HWREG16(HOSTSIM__FCTL3_ADDR)
+#define P1IN                HWREG8(HOSTSIM__P1IN_ADDR)
+#define P1OUT               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_OUT)
+#define P1DIR               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_DIR)
+#define P1IFG               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_IFG)
+#define P1IES               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_IES)
+#define P1IE                HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_IE)
+#define P1SEL               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_SEL)
+#define P1REN               HWREG8(HOSTSIM__P1IN_ADDR + HOSTSIM__PORT_REN)
+#define P2IN                HWREG8(HOSTSIM__P2IN_ADDR)
+#define P2OUT               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_OUT)
+#define P2DIR               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_DIR)
+#define P2IFG               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_IFG)
+#define P2IES               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_IES)
+#define P2IE                HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_IE)
+#define P2SEL               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_SEL)
+#define P2REN               HWREG8(HOSTSIM__P2IN_ADDR + HOSTSIM__PORT_REN)
+#define TAIV                HWREG16(HOSTSIM__TAIV_ADDR)
+#define TACTL               HWREG16(HOSTSIM__TACTL_ADDR)
+#define TACCTL0             HWREG16(HOSTSIM__TACCTL0_ADDR)
+#define TACCTL1             HWREG16(HOSTSIM__TACCTL0_ADDR + 2)
+#define TAR                 HWREG16(HOSTSIM__TAR_ADDR)
+#define TACCR0              HWREG16(HOSTSIM__TACCR0_ADDR)
+#define TACCR1              HWREG16(HOSTSIM__TACCR0_ADDR + 2)
+#define USICTL0             HWREG8(HOSTSIM__USICTL0_ADDR)
+#define USICTL1             HWREG8(HOSTSIM__USICTL1_ADDR)
+#define USICKCTL            HWREG8(HOSTSIM__USICKCTL_ADDR)
+#define USICNT              HWREG8(HOSTSIM__USICNT_ADDR)
+#define USISRL              HWREG8(HOSTSIM__USISRL_ADDR)
+#define USISRH              HWREG8(HOSTSIM__USISRH_ADDR)
+#define USICTL              HWREG16(HOSTSIM__USICTL0_ADDR)
+#define USICCTL             HWREG16(HOSTSIM__USICKCTL_ADDR)
+#define USISR               HWREG16(HOSTSIM__USISRL_ADDR)
+#define WDTCTL              HWREG16(HOSTSIM__WDTCTL_ADDR)
+#define CALDCO_1MHZ         HWREG8(HOSTSIM__CALDCO_1MHZ_ADDR)
+#define CALBC1_1MHZ         HWREG8(HOSTSIM__CALBC1_1MHZ_ADDR)
+
+#endif //_HOSTSIM_SFR_H_
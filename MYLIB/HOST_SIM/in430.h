@@ -0,0 +1,45 @@
+// *****************************************************************************
+// *  File: in430.h
+// *
+// *  Purpose:
+// *  Host replacement for the compiler intrinsic header included by the device
+// *  header. Status register intrinsics are routed to the host register
+// *  simulator, only used when MYLIB is built with MYLIB_HOST_SIM defined.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _HOSTSIM_IN430_H_
+#define _HOSTSIM_IN430_H_
+
+#include "hostsim.h"
+
+//Interrupt handlers are plain functions dispatched by the simulator
+#define __interrupt
+
+#define _bis_SR_register(x)                 HOSTSIM__BisSR(x)
+#define __bis_SR_register(x)                HOSTSIM__BisSR(x)
+#define _bic_SR_register(x)                 HOSTSIM__BicSR(x)
+#define __bic_SR_register(x)                HOSTSIM__BicSR(x)
+#define _bis_SR_register_on_exit(x)         HOSTSIM__BisSROnExit(x)
+#define __bis_SR_register_on_exit(x)        HOSTSIM__BisSROnExit(x)
+#define _bic_SR_register_on_exit(x)         HOSTSIM__BicSROnExit(x)
+#define __bic_SR_register_on_exit(x)        HOSTSIM__BicSROnExit(x)
+#define _get_SR_register()                  HOSTSIM__GetSR()
+#define __get_SR_register()                 HOSTSIM__GetSR()
+
+#define _enable_interrupts()                HOSTSIM__BisSR(GIE)
+#define __enable_interrupt()                HOSTSIM__BisSR(GIE)
+#define _disable_interrupts()               HOSTSIM__BicSR(GIE)
+#define __disable_interrupt()               HOSTSIM__BicSR(GIE)
+
+#define _no_operation()                     HOSTSIM__Delay(1)
+#define __no_operation()                    HOSTSIM__Delay(1)
+#define __delay_cycles(x)                   HOSTSIM__Delay(x)
+
+#endif //_HOSTSIM_IN430_H_
@@ -0,0 +1,21 @@
+// *****************************************************************************
+// *  File: intrinsics.h
+// *
+// *  Purpose:
+// *  Host replacement for the compiler intrinsics header, all intrinsics used
+// *  by MYLIB are provided by the host in430.h.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _HOSTSIM_INTRINSICS_H_
+#define _HOSTSIM_INTRINSICS_H_
+
+#include "in430.h"
+
+#endif //_HOSTSIM_INTRINSICS_H_
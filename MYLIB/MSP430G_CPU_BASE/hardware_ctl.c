@@ -1,77 +1,601 @@
-// ******************************************************************************
-// *  File: hardware_ctl.c
-// *
-// *  Purpose:                                                                         
-// *  Peripheral register base addresses for the Texas Instrument MSP430G2x21 series           
-// *  are defined here in this header file. All peripheral pin name definitions        
-// *  defined here. Pin allocations can be redefined here depending on application. 
-// *
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 27/08/2016  
-// *
-// *
-// *
-// *****************************************************************************
-
-#include "hardware_ctl.h"
-#include <stdint.h>
-
-//*****************************************************************************
-// Function: HW__InitialiseClock(void)
-// Purpose: Initialise deivce clock configuration on start up.
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void HW__InitialiseSystem(void)
-{
-    WDTCTL = WDTPW | WDTHOLD;   //Disable watchdog, utility not fully implemented
-
-    //Configure the DCOCTL and BCSCTL clock registers, load clock factory calibration
-    //MSP430G2x21 only has 1MHz factory calibration settings defined
-    HWREG16(DCO_CONTROL_REG_ADDR) = DCOCTL_STARTUP_CONFIG;
-    HWREG16(BCS_CONTROL_REG1_ADDR) = BCSCTL1_STARTUP_CONFIG;
-    HWREG16(BCS_CONTROL_REG2_ADDR) = BCSCTL2_STARTUP_CONFIG;
-    HWREG16(BCS_CONTROL_REG3_ADDR) = BCSCTL3_STARTUP_CONFIG;
-
-    LIBUTIL__Init(); 
-
-    //Check for clock fault, this only applies if external clock or low power source is used
-    while(HWREG16(BCS_CONTROL_REG3_ADDR) & (XT2S_FAULT_MASK + LFXT1_FAULT_MASK))
-    {
-        //TO DO need to produce debug indication when there is a clock fault
-        // Logging the error here will not suffice!
-        LIBUTIL__LogError(HW__EXT_CLOCK_FAULT);
-    }    
-
-    //Configure the TIMERA peripheral, set the timer clock source, clock division and operating mode
-    HWREG16(TIMERA_TACTL_REG_ADDR) = TIMERA_SOURCE_SMCLK + TIMERA_DIVIDE_1 + TIMERA_MODE_CONTINUOUS + TIMERA_TACLR_MASK;
-}
-
-//*****************************************************************************
-// Function: HW__EnterLowpower(void)
-// Purpose: Put device into low power mode
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void HW__EnterLowpower(void)
-{
-    _bis_SR_register(LPM0);    //Write to CPU status register
-}
-
-//*****************************************************************************
-// Function: HW__EnterDeepSleep(void)
-// Purpose: Put device into the lowest power setting
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void HW__EnterDeepSleep(void)
-{
-    _bis_SR_register(LPM4);    //Write to CPU status register
-}
+// ******************************************************************************
+// *  File: hardware_ctl.c
+// *
+// *  Purpose:                                                                         
+// *  Peripheral register base addresses for the Texas Instrument MSP430G2x21 series           
+// *  are defined here in this header file. All peripheral pin name definitions        
+// *  defined here. Pin allocations can be redefined here depending on application. 
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 27/08/2016  
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hardware_ctl.h"
+#include "interrupt.h"
+#include <stdint.h>
+
+// Private variables defined here
+static uint8_t DcoFrequency;
+static uint16_t TimerClockSource;
+static HW__ClockHandler_t ClockHandler[HW__NUM_CLOCK_USERS];
+static uint8_t ClockRequest[HW__NUM_CLOCK_USERS];
+static bool CrystalRunning;
+static bool LowpowerStale;          //Clocks released since the low power mode was chosen
+
+static const uint16_t DcoCalibrationAddress[HW__NUM_DCO_FREQUENCIES] = {
+    CAL_DATA_1MHZ_ADDR,
+    CAL_DATA_8MHZ_ADDR,
+    CAL_DATA_12MHZ_ADDR,
+    CAL_DATA_16MHZ_ADDR
+};
+
+static const uint32_t DcoFrequencyHz[HW__NUM_DCO_FREQUENCIES] = {
+    1000000,
+    8000000,
+    12000000,
+    16000000
+};
+
+//*****************************************************************************
+// Purpose: Look up the DCO settings for a calibrated frequency. Settings tuned
+//          in system take priority over the factory calibration.
+// Argument: frequency - HW__DCO_* frequency
+//           dcoctl - DCOCTL setting read
+//           bcsctl1 - BCSCTL1 setting read
+// Return: True if calibration data is present for the frequency
+//
+//*****************************************************************************
+
+static bool ReadCalibration(uint8_t frequency, uint8_t *dcoctl, uint8_t *bcsctl1)
+{
+    *dcoctl = HWREG8(CAL_CACHE_ADDR + (2 * frequency));
+    *bcsctl1 = HWREG8(CAL_CACHE_ADDR + (2 * frequency) + 1);
+
+    if((*dcoctl == CAL_DATA_ERASED) && (*bcsctl1 == CAL_DATA_ERASED))
+    {
+        *dcoctl = HWREG8(DcoCalibrationAddress[frequency]);
+        *bcsctl1 = HWREG8(DcoCalibrationAddress[frequency] + 1);
+    }
+
+    return !((*dcoctl == CAL_DATA_ERASED) && (*bcsctl1 == CAL_DATA_ERASED));
+}
+
+//*****************************************************************************
+// Purpose: Notify the registered drivers of a Timer A clock frequency change.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void NotifyClockChange(void)
+{
+    uint32_t timer_hz = HW__GetTimerClockFrequency();
+    uint8_t user;
+
+    for(user = 0; user < HW__NUM_CLOCK_USERS; user++)
+    {
+        if(ClockHandler[user])
+        {
+            ClockHandler[user](timer_hz);
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Move Timer A onto another clock source. The timer is stopped while
+//          the source is changed, the count carries on from where it was.
+// Argument: source - TIMERA_SOURCE_SMCLK or TIMERA_SOURCE_ACLK
+// Return: None
+//
+//*****************************************************************************
+
+static void SetTimerClockSource(uint16_t source)
+{
+    uint16_t mode;
+    uint16_t state;
+
+    if(source == TimerClockSource)
+    {
+        return;
+    }
+
+    state = INT__EnterCritical();
+    mode = HWREG16(TIMERA_TACTL_REG_ADDR) & TIMERA_MODE_UPDOWN;
+
+    //Each write changes only its own bits, a TAIFG set by a wrap just before
+    //the stop is kept for the uptime overflow count. The stopped timer can
+    //not wrap while the source is changed.
+    HWREG16(TIMERA_TACTL_REG_ADDR) &= ~TIMERA_MODE_UPDOWN;
+    HWREG16(TIMERA_TACTL_REG_ADDR) = (HWREG16(TIMERA_TACTL_REG_ADDR) & ~HW__TIMERA_SOURCE_MASK) | source;
+    HWREG16(TIMERA_TACTL_REG_ADDR) |= mode;
+    TimerClockSource = source;
+    NotifyClockChange();
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Combine the clock requests of all users.
+// Argument: None
+// Return: Requested clocks
+//
+//*****************************************************************************
+
+static uint8_t RequestedClocks(void)
+{
+    uint8_t clocks = HW__CLOCK_NONE;
+    uint8_t user;
+
+    for(user = 0; user < HW__NUM_CLOCK_USERS; user++)
+    {
+        clocks |= ClockRequest[user];
+    }
+
+    return clocks;
+}
+
+//*****************************************************************************
+// Purpose: Clear the oscillator fault flag and check whether it has been set
+//          again since, either by a fault found straight away or by one found
+//          since the flag was last cleared.
+// Argument: None
+// Return: True if the crystal is faulty
+//
+//*****************************************************************************
+
+static bool CrystalFaulty(void)
+{
+    bool faulty = (HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) & SFR_OSC_FAULT_MASK) || (HWREG8(BCS_CONTROL_REG3_ADDR) & LFXT1_FAULT_MASK);
+
+    HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) &= ~SFR_OSC_FAULT_MASK;
+
+    return faulty;
+}
+
+//*****************************************************************************
+// Purpose: Give the crystal a bounded time to start up.
+// Argument: None
+// Return: True if the crystal has settled
+//
+//*****************************************************************************
+
+static bool WaitForCrystal(void)
+{
+    uint8_t poll;
+
+    CrystalFaulty();
+
+    for(poll = 0; poll < HW__CRYSTAL_STARTUP_POLLS; poll++)
+    {
+        __delay_cycles(HW__CRYSTAL_POLL_CYCLES);
+
+        if(!CrystalFaulty())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//*****************************************************************************
+// Function: HW__InitialiseClock(void)
+// Purpose: Initialise deivce clock configuration on start up.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void HW__InitialiseSystem(void)
+{
+    uint8_t dcoctl;
+    uint8_t bcsctl1;
+    uint8_t user;
+
+    WDTCTL = WDTPW | WDTHOLD;   //Hold watchdog through start up, started by WATCHDOG__Reset
+
+    //Configure the DCOCTL and BCSCTL clock registers, load clock factory calibration
+    //MSP430G2x21 only has 1MHz factory calibration settings defined
+    HWREG8(DCO_CONTROL_REG_ADDR) = DCOCTL_STARTUP_CONFIG;
+    HWREG8(BCS_CONTROL_REG1_ADDR) = BCSCTL1_STARTUP_CONFIG;
+    HWREG8(BCS_CONTROL_REG2_ADDR) = BCSCTL2_STARTUP_CONFIG;
+    HWREG8(BCS_CONTROL_REG3_ADDR) = BCSCTL3_STARTUP_CONFIG;
+    DcoFrequency = HW__DCO_1MHZ;
+    TimerClockSource = TIMERA_SOURCE_SMCLK;
+
+    for(user = 0; user < HW__NUM_CLOCK_USERS; user++)
+    {
+        ClockHandler[user] = 0;
+        ClockRequest[user] = HW__CLOCK_NONE;
+    }
+
+    //Start from the tuned 1MHz setting when one has been cached
+    if(ReadCalibration(HW__DCO_1MHZ, &dcoctl, &bcsctl1))
+    {
+        HW__WriteDcoSetting(dcoctl, bcsctl1);
+    }
+
+    LIBUTIL__Init(); 
+
+    //Check for clock fault, a crystal still starting up or missing leaves the
+    //timers on the DCO until HW__PollCrystal finds it running
+    CrystalRunning = WaitForCrystal();
+
+    if(CrystalRunning)
+    {
+        INT__Enable(OSC_FAULT_INT);
+    }
+    else
+    {
+        LIBUTIL__LogError(HW__EXT_CLOCK_FAULT);
+    }    
+
+    //Configure the TIMERA peripheral, set the timer clock source, clock division and operating mode
+    HWREG16(TIMERA_TACTL_REG_ADDR) = TIMERA_SOURCE_SMCLK + TIMERA_DIVIDE_1 + TIMERA_MODE_CONTINUOUS + TIMERA_TACLR_MASK;
+
+    //TA0.1 output held low, it is the ADC10 sample trigger for timed sampling
+    HWREG16(TIMERA_TACCTL1_REG_ADDR) = TIMERA_COMPARE_MODE + TIMERA_OUTMOD_OUT;
+}
+
+//*****************************************************************************
+// Function: HW__EnterLowpower(void)
+// Purpose: Put device into the deepest low power mode that keeps every
+//          requested clock running. Timer A is moved onto ACLK when no user
+//          needs SMCLK and the crystal is running, so the timers keep counting
+//          in LPM3. With INT__ISR_STATS defined Timer A stays on SMCLK, the
+//          handler run times are kept in SMCLK cycles. Interrupts are enabled
+//          in the same instruction so a wake up can not be lost between the
+//          caller's last check and entering low power mode. To be called
+//          with interrupts disabled.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void HW__EnterLowpower(void)
+{
+    uint8_t clocks = RequestedClocks();
+
+    LowpowerStale = false;
+
+    if(clocks & HW__CLOCK_TIMERA)
+    {
+#ifndef INT__ISR_STATS
+        if(!(clocks & HW__CLOCK_SMCLK) && CrystalRunning)
+        {
+            SetTimerClockSource(TIMERA_SOURCE_ACLK);
+        }
+#endif
+
+        clocks |= (TimerClockSource == TIMERA_SOURCE_ACLK) ? HW__CLOCK_ACLK : HW__CLOCK_SMCLK;
+    }
+
+    if(clocks & HW__CLOCK_SMCLK)
+    {
+        _bis_SR_register(LPM0_bits + GIE);    //CPU off, SMCLK and ACLK running
+    }
+    else if(clocks & HW__CLOCK_ACLK)
+    {
+        _bis_SR_register(LPM3_bits + GIE);    //Only ACLK running
+    }
+    else
+    {
+        _bis_SR_register(LPM4_bits + GIE);    //All clocks off, the ADC10 oscillator runs on demand
+    }
+}
+
+//*****************************************************************************
+// Function: HW__EnterDeepSleep(void)
+// Purpose: Put device into the lowest power setting
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void HW__EnterDeepSleep(void)
+{
+    _bis_SR_register(LPM4_bits);    //Write to CPU status register
+}
+
+//*****************************************************************************
+// Function: HW__RegisterClockHandler(uint8_t user, HW__ClockHandler_t handler)
+// Purpose: Register a driver to be notified when the Timer A clock changes,
+//          e.g. to recalculate timer compare intervals.
+// Argument: user - Clock user ID
+//           handler - Called on every frequency change, null to unregister
+// Return: None
+//
+//*****************************************************************************
+
+void HW__RegisterClockHandler(uint8_t user, HW__ClockHandler_t handler)
+{
+    if(user < HW__NUM_CLOCK_USERS)
+    {
+        ClockHandler[user] = handler;
+    }
+}
+
+//*****************************************************************************
+// Function: HW__SetDcoFrequency(uint8_t frequency)
+// Purpose: Switch MCLK and SMCLK to another factory calibrated DCO frequency.
+//          The registered drivers are notified before interrupts are restored
+//          if Timer A runs from SMCLK, so no timer interrupt is serviced with
+//          stale compare intervals.
+// Argument: frequency - HW__DCO_1MHZ, HW__DCO_8MHZ, HW__DCO_12MHZ or
+//                       HW__DCO_16MHZ
+// Return: None
+//
+//*****************************************************************************
+
+void HW__SetDcoFrequency(uint8_t frequency)
+{
+    uint16_t state;
+    uint8_t dcoctl;
+    uint8_t bcsctl1;
+
+    if(frequency >= HW__NUM_DCO_FREQUENCIES)
+    {
+        LIBUTIL__LogError(HW__INVALID_DCO_FREQUENCY);
+        return;
+    }
+
+    //Keep the current frequency if the device carries no calibration for it
+    if(!ReadCalibration(frequency, &dcoctl, &bcsctl1))
+    {
+        LIBUTIL__LogError(HW__DCO_NOT_CALIBRATED);
+        return;
+    }
+
+    state = INT__EnterCritical();
+
+    HW__WriteDcoSetting(dcoctl, bcsctl1);
+    DcoFrequency = frequency;
+
+    if(TimerClockSource == TIMERA_SOURCE_SMCLK)
+    {
+        NotifyClockChange();
+    }
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Function: HW__WriteDcoSetting(uint8_t dcoctl, uint8_t bcsctl1)
+// Purpose: Load a DCO setting. The registered drivers are not notified, the
+//          caller is responsible for keeping the nominal frequency.
+// Argument: dcoctl - DCOCTL setting
+//           bcsctl1 - BCSCTL1 setting, only the range select bits are used
+// Return: None
+//
+//*****************************************************************************
+
+void HW__WriteDcoSetting(uint8_t dcoctl, uint8_t bcsctl1)
+{
+    //Drop to the lowest DCO tap first so the clock never overshoots while the
+    //range is changed
+    HWREG8(DCO_CONTROL_REG_ADDR) = 0;
+    HWREG8(BCS_CONTROL_REG1_ADDR) = (HWREG8(BCS_CONTROL_REG1_ADDR) & ~BCSCTL1_RSEL_MASK) | (bcsctl1 & BCSCTL1_RSEL_MASK);
+    HWREG8(DCO_CONTROL_REG_ADDR) = dcoctl;
+}
+
+//*****************************************************************************
+// Function: HW__GetDcoFrequencyHz(uint8_t frequency)
+// Purpose: Read the nominal frequency of a calibrated DCO setting.
+// Argument: frequency - HW__DCO_* frequency
+// Return: Frequency in Hz, zero for an invalid frequency
+//
+//*****************************************************************************
+
+uint32_t HW__GetDcoFrequencyHz(uint8_t frequency)
+{
+    if(frequency >= HW__NUM_DCO_FREQUENCIES)
+    {
+        return 0;
+    }
+
+    return DcoFrequencyHz[frequency];
+}
+
+//*****************************************************************************
+// Function: HW__GetSmclkFrequency(void)
+// Purpose: Read the nominal SMCLK frequency.
+// Argument: None
+// Return: SMCLK frequency in Hz
+//
+//*****************************************************************************
+
+uint32_t HW__GetSmclkFrequency(void)
+{
+    return DcoFrequencyHz[DcoFrequency];
+}
+
+//*****************************************************************************
+// Function: HW__GetTimerClockFrequency(void)
+// Purpose: Read the nominal Timer A clock frequency, timer counts and compare
+//          intervals are in periods of this clock.
+// Argument: None
+// Return: Timer A clock frequency in Hz
+//
+//*****************************************************************************
+
+uint32_t HW__GetTimerClockFrequency(void)
+{
+    if(TimerClockSource == TIMERA_SOURCE_ACLK)
+    {
+        return HW__ACLK_HZ;
+    }
+
+    return DcoFrequencyHz[DcoFrequency];
+}
+
+//*****************************************************************************
+// Function: HW__RequestClocks(uint8_t user, uint8_t clocks)
+// Purpose: Set the clocks a user needs kept running while the CPU is idle,
+//          replacing its previous request. A request for SMCLK moves Timer A
+//          back onto SMCLK straight away for full timer resolution. Releasing
+//          a clock the idle path may be sleeping with marks the low power
+//          mode stale, so the interrupt vectors wake the idle path to choose
+//          it again.
+// Argument: user - Clock user ID
+//           clocks - HW__CLOCK_* flags, HW__CLOCK_NONE to release
+// Return: None
+//
+//*****************************************************************************
+
+void HW__RequestClocks(uint8_t user, uint8_t clocks)
+{
+    uint8_t released;
+    uint16_t state;
+
+    if(user >= HW__NUM_CLOCK_USERS)
+    {
+        return;
+    }
+
+    state = INT__EnterCritical();
+
+    released = RequestedClocks();
+    ClockRequest[user] = clocks;
+    released &= ~RequestedClocks();
+
+    if(released & (HW__CLOCK_SMCLK | HW__CLOCK_ACLK | HW__CLOCK_TIMERA))
+    {
+        LowpowerStale = true;
+    }
+
+    if(clocks & HW__CLOCK_SMCLK)
+    {
+        SetTimerClockSource(TIMERA_SOURCE_SMCLK);
+    }
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Function: HW__IsLowpowerStale(void)
+// Purpose: Check whether clocks have been released since the idle path chose
+//          its low power mode, for the interrupt vectors to exit it.
+// Argument: None
+// Return: True if the low power mode is to be chosen again
+//
+//*****************************************************************************
+
+bool HW__IsLowpowerStale(void)
+{
+    return LowpowerStale;
+}
+
+//*****************************************************************************
+// Function: HW__IsCrystalRunning(void)
+// Purpose: Check whether the LFXT1 crystal is running and sourcing ACLK.
+// Argument: None
+// Return: True if the crystal is running
+//
+//*****************************************************************************
+
+bool HW__IsCrystalRunning(void)
+{
+    return CrystalRunning;
+}
+
+//*****************************************************************************
+// Function: HW__PollCrystal(void)
+// Purpose: Background crystal start up, to be called periodically. The fault
+//          flag is left to collect faults between calls, the crystal is taken
+//          as settled once a whole poll interval passes without one. The
+//          oscillator fault interrupt is then re-armed and the power manager
+//          moves Timer A back onto ACLK at the next idle.
+// Argument: None
+// Return: True if the crystal is running
+//
+//*****************************************************************************
+
+bool HW__PollCrystal(void)
+{
+    uint16_t state;
+
+    if(!CrystalRunning && !CrystalFaulty())
+    {
+        state = INT__EnterCritical();
+
+        CrystalRunning = true;
+        INT__Enable(OSC_FAULT_INT);
+
+        INT__ExitCritical(state);
+    }
+
+    return CrystalRunning;
+}
+
+//*****************************************************************************
+// Function: HW__OscillatorFaultHandler(void)
+// Purpose: Oscillator fault handler, called from the NMI vector. The NMI has
+//          already cleared the fault interrupt enable, it stays disabled as
+//          the flag is set for as long as the fault lasts. Timer A is moved
+//          back onto SMCLK, counts missed while ACLK was stopped are lost.
+//          The watchdog manager restarts a held watchdog on recovery.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void HW__OscillatorFaultHandler(void)
+{
+    uint16_t wdtctl = HWREG16(WATCHDOG_CONTROL_REG_ADDR) & WATCHDOG_CONFIG_MASK;
+
+    //An ACLK sourced watchdog fails safe onto MCLK, hold it until the crystal
+    //is back rather than let it expire within milliseconds
+    if(wdtctl & WATCHDOG_SOURCE_ACLK)
+    {
+        HWREG16(WATCHDOG_CONTROL_REG_ADDR) = WATCHDOG_PASSWORD | wdtctl | WATCHDOG_HOLD;
+    }
+
+    CrystalRunning = false;
+    SetTimerClockSource(TIMERA_SOURCE_SMCLK);
+    LIBUTIL__LogError(HW__EXT_CLOCK_FAULT);
+}
+
+//*****************************************************************************
+// Function: HW__WriteInfoSegment(uint16_t address, const uint8_t *data, uint8_t length)
+// Purpose: Erase an information memory segment and program it with new data.
+//          The CPU is held for the segment erase, around 12ms, and interrupts
+//          are disabled throughout as the flash can not be read meanwhile.
+// Argument: address - Start of the information memory segment
+//           data - Data to program from the start of the segment
+//           length - Number of bytes to program, at most INFO_SEGMENT_SIZE
+// Return: None
+//
+//*****************************************************************************
+
+void HW__WriteInfoSegment(uint16_t address, const uint8_t *data, uint8_t length)
+{
+    uint16_t state;
+    uint16_t divider;
+    uint8_t index;
+
+    //Flash timing generator clocked from MCLK, divided into its valid range
+    divider = (uint16_t)((HW__GetSmclkFrequency() + FLASH_TIMING_HZ - 1) / FLASH_TIMING_HZ);
+
+    state = INT__EnterCritical();
+
+    HWREG16(FLASH_FCTL2_REG_ADDR) = FWKEY + FSSEL_1 + ((divider - 1) & FLASH_DIVIDER_MASK);
+    HWREG16(FLASH_FCTL3_REG_ADDR) = FWKEY;              //Unlock, segment A lock left untouched
+    HWREG16(FLASH_FCTL1_REG_ADDR) = FWKEY + ERASE;
+    HWREG8(address) = 0;                                //Dummy write starts the segment erase
+
+    HWREG16(FLASH_FCTL1_REG_ADDR) = FWKEY + WRT;
+
+    for(index = 0; (index < length) && (index < INFO_SEGMENT_SIZE); index++)
+    {
+        HWREG8(address + index) = data[index];
+    }
+
+    HWREG16(FLASH_FCTL1_REG_ADDR) = FWKEY;
+    HWREG16(FLASH_FCTL3_REG_ADDR) = FWKEY + LOCK;
+
+    INT__ExitCritical(state);
+}
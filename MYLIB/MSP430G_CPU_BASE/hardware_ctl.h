@@ -1,290 +1,599 @@
-// ******************************************************************************
-// *  File: hardware_ctl.h
-// *
-// *  Purpose:                                                                         
-// *  Peripheral register base addresses for the Texas Instrument MSP430G2x21 series           
-// *  are defined here in this header file. All peripheral pin name definitions        
-// *  defined here. Pin allocations can be redefined here depending on application. 
-// *
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 27/08/2016  
-// *
-// *
-// *
-// *****************************************************************************
- 
-#ifndef __HARDWARE_CTL__
-#define __HARDWARE_CTL__
-
-#include "libUtility.h"
-
-//*****************************************************************************
-//
-// Include device specific header file
-//
-//*****************************************************************************
-#include "msp430g2231.h" //Device specific header file defined here
-
-#define COMPILED_HARDWARE_CTL
-
-//*****************************************************************************
-//
-// MSP Port base address defined here, port availability defined in device
-// header file.
-//
-//*****************************************************************************
-
-#define MSP_PORT_AVAILABLE 0
-
-#ifdef __MSP430_HAS_PORT1_R__   //Check for Port availability
-#define MSP430_PORT1_ADDR 0x0020  //Port base address
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 1
-#endif
-
-#ifdef __MSP430_HAS_PORT2_R__
-#define MSP430_PORT2_ADDR 0x0028
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 2
-#endif
-
-#ifdef __MSP430_HAS_PORT3_R__
-#define MSP430_PORT3_ADDR 0x0018
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 3
-#endif
-
-#ifdef __MSP430_HAS_PORT4_R__
-#define MSP430_PORT4_ADDR 0x001c
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 4
-#endif
-
-#ifdef __MSP430_HAS_PORT5_R__
-#define MSP430_PORT5_ADDR 0x0030
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 5
-#endif
-
-#ifdef __MSP430_HAS_PORT6_R__
-#define MSP430_PORT6_ADDR 0x0034
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 6
-#endif
-
-#ifdef __MSP430_HAS_PORT7_R__
-#define MSP430_PORT7_ADDR 0x0038
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 7
-#endif
-
-#ifdef __MSP430_HAS_PORT8_R__
-#define MSP430_PORT8_ADDR 0x0039
-#undef  MSP_PORT_AVAILABLE
-#define MSP_PORT_AVAILABLE 8
-#endif
-
-//*****************************************************************************
-//
-// GPIO register memory address offsets defined here.
-//
-//*****************************************************************************
-
-#define OFS_PIN     (0x0000)  //Memory address offset to PxIN register
-#define OFS_POUT    (0x0001)  //Memory address offset to PxOUT register
-#define OFS_PDIR    (0x0002)  //Memory address offset to PxDIR register
-#define OFS_PREN    (0x0007)  //Memory address offset to PxREN register
-#define OFS_PSEL_1  (0x0006)  //Memory address offset to PxSEL register
-#define OFS_PSEL_2  (0x0004)  //Memory address offset to PxSEL register for port 3 and onwards
-#define OFS_IFG     (0x0003)  //Memory address offset to PxIFG register
-#define OFS_IE      (0x0005)  //Memory address offset to PxIE register
-
-//*****************************************************************************
-//
-// Clock control register base addresses, offset and constants defined here.
-//
-//*****************************************************************************
-
-//Clock module register addresses
-#define DCO_CONTROL_REG_ADDR                 (0x0056)
-#define BCS_CONTROL_REG1_ADDR                (0x0057)
-#define BCS_CONTROL_REG2_ADDR                (0x0058)
-#define BCS_CONTROL_REG3_ADDR                (0x0053)
-#define SFR_INTERRUPT_EN_REG_ADDR            (0x0000)
-#define SFR_INTERRUPT_FLAG_REG_ADDR          (0x0002)
-
-//Clock frequency calibration data addresses
-#define CAL_DCOCTL_1MHZ                      CALDCO_1MHZ  //DCO calibration for 1MHz
-#define CAL_BCSCTL1_1MHZ                     CALBC1_1MHZ  //BCSCTL1 calibration for 1MHz
-
-//XT2S source enable
-#define XT2S_OFF                             0x80         //Default is off
-
-//LFXT1 mode selection
-#define XTS_LOW_FREQUENCY                    0x00         //Low frequency mode
-#define XTS_HIGH_FREQUENCY                   0x40         //High frequency mode
-
-//ACLK clock division selection
-#define ACLK_DIVIDE_1                        0x00
-#define ACLK_DIVIDE_2                        0x10
-#define ACLK_DIVIDE_4                        0x20
-#define ACLK_DIVIDE_8                        0x30
-
-//MCLK clock source selection
-#define MCLK_SOURCE_DEFAULT                  0x00         //Chip default
-#define MCLK_SOURCE_DCOCLK                   MCLK_SOURCE_DEFAULT
-#define MCLK_SOURCE_XT2CLK                   0x80
-#define MCLK_SOURCE_LFXT1CLK                 0xC0
-
-//MCLK clock division selection
-#define MCLK_DIVIDE_1                        0x00         //Chip default
-#define MCLK_DIVIDE_2                        0x10
-#define MCLK_DIVIDE_4                        0x80
-#define MCLK_DIVIDE_8                        0xC0
-
-//SMCLK clock source selection
-#define SMCLK_SOURCE_DCOCLK                  0x00         //Chip default
-#define SMCLK_SOURCE_XT2CLK                  0x08
-
-//SMCLK clock division selection
-#define SMCLK_DIVIDE_1                       0x00         //Chip default
-#define SMCLK_DIVIDE_2                       0x02
-#define SMCLK_DIVIDE_4                       0x04
-#define SMCLK_DIVIDE_8                       0x06
-
-//XT2S Frequency range selection
-#define XT2S_RANGE_1MHZ                      0x00         //0.4 to 1-MHz crystal or resonator (Chip default)
-#define XT2S_RANGE_3MHZ                      0x40         //1.0 to 3-MHz crystal or resonator
-#define XT2S_RANGE_16MHZ                     0x80         //3.0 to 16-MHz crystal or resonator
-#define XT2S_RANGE_DIGITAL_SRC               0xC0         //Digital external 0.4- to 16-MHz clock source
-
-//Low-frequency clock select and LFXT1 range select. These bits select between LFXT1 and VLO when XTS =
-//0, and select the frequency range for LFXT1 when XTS = 1.
-//When XTS = 0:
-//00 32768-Hz crystal on LFXT1
-//01 Reserved
-//10 VLOCLK (Reserved in MSP430F21x1 devices)
-//11 Digital external clock source
-//When XTS = 1 (Not applicable for MSP430x20xx devices, MSP430G2xx1/2/3)
-//00 0.4- to 1-MHz crystal or resonator
-//01 1- to 3-MHz crystal or resonator
-//10 3- to 16-MHz crystal or resonator
-//11 Digital external 0.4- to 16-MHz clock source
-
-#define LFXT1S_RANGE_1MHZ                    0x00
-#define LFXT1S_RANGE_3MHZ                    0x10
-#define LFXT1S_RANGE_16MHZ                   0x20
-#define LFXT1S_RANGE_DIGITAL_SRC             0x30
-
-//XT2S internal clock capacitor config
-#define XCAP_1PF                             0x00
-#define XCAP_6PF                             0x04
-#define XCAP_10PF                            0x08
-#define XCAP_12_5PF                          0x0C
-
-//XT2S and LFXT1 clock fault flag mask
-#define XT2S_FAULT_MASK                      0x02
-#define LFXT1_FAULT_MASK                     0x01
-
-//Clock register configuration defined here, this constant is loaded to the register
-//on start up.
-
-#define DCOCTL_STARTUP_CONFIG                CAL_DCOCTL_1MHZ
-#define BCSCTL1_STARTUP_CONFIG               (CAL_BCSCTL1_1MHZ + XT2S_OFF + XTS_LOW_FREQUENCY + ACLK_DIVIDE_1)
-#define BCSCTL2_STARTUP_CONFIG               (MCLK_SOURCE_DEFAULT + MCLK_DIVIDE_1 + SMCLK_SOURCE_DCOCLK + SMCLK_DIVIDE_1)
-#define BCSCTL3_STARTUP_CONFIG               (XT2S_RANGE_1MHZ + LFXT1S_RANGE_1MHZ + XCAP_1PF)
-
-//*****************************************************************************
-//
-// Timer peripheral control register base addresses, offset and constants 
-// defined here.
-//
-//*****************************************************************************
-
-#define TIMERA_TACTL_REG_ADDR                (0x0160)
-#define TIMERA_TAR_REG_ADDR                  (0x0170)
-#define TIMERA_TACCTL0_REG_ADDR              (0x0162)
-#define TIMERA_TACCR0_REG_ADDR               (0x0172)
-#define TIMERA_TACCTL1_REG_ADDR              (0x0164)
-#define TIMERA_TACCR1_REG_ADDR               (0x0174)
-#define TIMERA_TACCTL2_REG_ADDR              (0x0166)
-#define TIMERA_TACCR2_REG_ADDR               (0x0176)
-#define TIMERA_TAIV_REG_ADDR                 (0x012E)
-
-//Timer A clock source select
-#define TIMERA_SOURCE_TACLK                   0x0000
-#define TIMERA_SOURCE_ACLK                    0x0100
-#define TIMERA_SOURCE_SMCLK                   0x0200
-#define TIMERA_SOURCE_INCLK                   0x0C00
-
-//Timer A clock division
-#define TIMERA_DIVIDE_1                       0x0000
-#define TIMERA_DIVIDE_2                       0x0040
-#define TIMERA_DIVIDE_4                       0x0080
-#define TIMERA_DIVIDE_8                       0x0C00
-
-//Timer A operating mode
-#define TIMERA_MODE_STOP                      0x0000
-#define TIMERA_MODE_UPMODE                    0x0010
-#define TIMERA_MODE_CONTINUOUS                0x0020
-#define TIMERA_MODE_UPDOWN                    0x0030
-
-//Timer A Capture/Compare modes
-#define TIMERA_NO_CAPTURE                     0x0000
-#define TIMERA_CAP_RISING                     0x4000
-#define TIMERA_CAP_FALLING                    0x8000
-#define TIMERA_CAP_ALL                        0xC000
-
-//Timer A capture modes
-#define TIMERA_COMPARE_MODE                   0x0000
-#define TIMERA_CAPTURE_MODE                   0x0100
-
-//Capture and Compare interrupt enable mask
-#define TIMERA_CCIE_MASK                      0x0010
-
-//Capture and Compare interrupt flag mask
-#define TIMERA_CCIFG_MASK                     0x0001
-#define TIMERA_TAIV_CCR1_CCIFG                0x0002
-#define TIMERA_TAIV_CCR2_CCIFG                0x0004
-
-//Timer A interrupt enable mask
-#define TIMERA_TAIE_MASK                      0x0002
-
-//Timer A interrupt flag mask
-#define TIMERA_TAIFG_MASK                     0x0001
-
-//Timer A clear bit mask
-#define TIMERA_TACLR_MASK                     0x0004
-
-//*****************************************************************************
-//
-// Hardware error codes
-//
-//*****************************************************************************
-
-#define HW__EXT_CLOCK_FAULT                   1
-
-//*****************************************************************************
-//
-// Macros for hardware memory address access
-//
-//*****************************************************************************
-#define HWREG32(x)                                                              \
-    (*((volatile uint32_t *)((uint16_t)x)))
-#define HWREG16(x)                                                             \
-    (*((volatile uint16_t *)((uint16_t)x)))
-#define HWREG8(x)                                                             \
-    (*((volatile uint8_t *)((uint16_t)x)))
-
-//*****************************************************************************
-//
-// Function prototypes defined here
-//
-//*****************************************************************************
-
-void HW__InitialiseSystem(void);
-void HW__EnterLowpower(void);
-void HW__EnterDeepSleep(void);
-
-#endif  //__HARDWARE_CTL__
+// ******************************************************************************
+// *  File: hardware_ctl.h
+// *
+// *  Purpose:                                                                         
+// *  Peripheral register base addresses for the Texas Instrument MSP430G2x21 series           
+// *  are defined here in this header file. All peripheral pin name definitions        
+// *  defined here. Pin allocations can be redefined here depending on application. 
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 27/08/2016  
+// *
+// *
+// *
+// *****************************************************************************
+ 
+#ifndef __HARDWARE_CTL__
+#define __HARDWARE_CTL__
+
+#include "libUtility.h"
+
+//*****************************************************************************
+//
+// Include device specific header file
+//
+//*****************************************************************************
+#include "msp430g2231.h" //Device specific header file defined here
+
+#ifdef MYLIB_HOST_SIM
+#include "hostsim.h"      //Host register simulator, named registers remapped
+#include "hostsim_sfr.h"
+#endif
+
+#define COMPILED_HARDWARE_CTL
+
+//*****************************************************************************
+//
+// MSP Port base address defined here, port availability defined in device
+// header file.
+//
+//*****************************************************************************
+
+#define MSP_PORT_AVAILABLE 0
+
+#ifdef __MSP430_HAS_PORT1_R__   //Check for Port availability
+#define MSP430_PORT1_ADDR 0x0020  //Port base address
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 1
+#endif
+
+#ifdef __MSP430_HAS_PORT2_R__
+#define MSP430_PORT2_ADDR 0x0028
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 2
+#endif
+
+#ifdef __MSP430_HAS_PORT3_R__
+#define MSP430_PORT3_ADDR 0x0018
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 3
+#endif
+
+#ifdef __MSP430_HAS_PORT4_R__
+#define MSP430_PORT4_ADDR 0x001c
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 4
+#endif
+
+#ifdef __MSP430_HAS_PORT5_R__
+#define MSP430_PORT5_ADDR 0x0030
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 5
+#endif
+
+#ifdef __MSP430_HAS_PORT6_R__
+#define MSP430_PORT6_ADDR 0x0034
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 6
+#endif
+
+#ifdef __MSP430_HAS_PORT7_R__
+#define MSP430_PORT7_ADDR 0x0038
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 7
+#endif
+
+#ifdef __MSP430_HAS_PORT8_R__
+#define MSP430_PORT8_ADDR 0x0039
+#undef  MSP_PORT_AVAILABLE
+#define MSP_PORT_AVAILABLE 8
+#endif
+
+//*****************************************************************************
+//
+// GPIO register memory address offsets defined here.
+//
+//*****************************************************************************
+
+#define OFS_PIN     (0x0000)  //Memory address offset to PxIN register
+#define OFS_POUT    (0x0001)  //Memory address offset to PxOUT register
+#define OFS_PDIR    (0x0002)  //Memory address offset to PxDIR register
+#define OFS_PREN    (0x0007)  //Memory address offset to PxREN register
+#define OFS_PSEL_1  (0x0006)  //Memory address offset to PxSEL register
+#define OFS_PSEL_2  (0x0004)  //Memory address offset to PxSEL register for port 3 and onwards
+#define OFS_IFG     (0x0003)  //Memory address offset to PxIFG register
+#define OFS_IE      (0x0005)  //Memory address offset to PxIE register
+#define OFS_PIES    (0x0004)  //Memory address offset to PxIES register
+
+//*****************************************************************************
+//
+// Clock control register base addresses, offset and constants defined here.
+//
+//*****************************************************************************
+
+//Clock module register addresses
+#define DCO_CONTROL_REG_ADDR                 (0x0056)
+#define BCS_CONTROL_REG1_ADDR                (0x0057)
+#define BCS_CONTROL_REG2_ADDR                (0x0058)
+#define BCS_CONTROL_REG3_ADDR                (0x0053)
+#define SFR_INTERRUPT_EN_REG_ADDR            (0x0000)
+#define SFR_INTERRUPT_FLAG_REG_ADDR          (0x0002)
+
+//Clock frequency calibration data addresses
+#define CAL_DCOCTL_1MHZ                      CALDCO_1MHZ  //DCO calibration for 1MHz
+#define CAL_BCSCTL1_1MHZ                     CALBC1_1MHZ  //BCSCTL1 calibration for 1MHz
+
+//Calibration data locations in information memory segment A, DCOCTL value
+//followed by the BCSCTL1 value. Left erased when a frequency is not calibrated,
+//the MSP430G2x21 only carries the 1MHz calibration.
+#define CAL_DATA_16MHZ_ADDR                  (0x10F8)
+#define CAL_DATA_12MHZ_ADDR                  (0x10FA)
+#define CAL_DATA_8MHZ_ADDR                   (0x10FC)
+#define CAL_DATA_1MHZ_ADDR                   (0x10FE)
+#define CAL_DATA_ERASED                      0xFF
+
+//DCO settings tuned in system against the ACLK crystal, cached in information
+//memory segment B. One DCOCTL and BCSCTL1 pair per HW__DCO_* frequency, used in
+//place of the factory calibration when present.
+#define CAL_CACHE_ADDR                       (0x1080)
+
+//BCSCTL1 range select bits loaded from the calibration data
+#define BCSCTL1_RSEL_MASK                    0x0F
+
+//XT2S source enable
+#define XT2S_OFF                             0x80         //Default is off
+
+//LFXT1 mode selection
+#define XTS_LOW_FREQUENCY                    0x00         //Low frequency mode
+#define XTS_HIGH_FREQUENCY                   0x40         //High frequency mode
+
+//ACLK clock division selection
+#define ACLK_DIVIDE_1                        0x00
+#define ACLK_DIVIDE_2                        0x10
+#define ACLK_DIVIDE_4                        0x20
+#define ACLK_DIVIDE_8                        0x30
+#define ACLK_DIVIDE_MASK                     0x30
+
+//MCLK clock source selection
+#define MCLK_SOURCE_DEFAULT                  0x00         //Chip default
+#define MCLK_SOURCE_DCOCLK                   MCLK_SOURCE_DEFAULT
+#define MCLK_SOURCE_XT2CLK                   0x80
+#define MCLK_SOURCE_LFXT1CLK                 0xC0
+
+//MCLK clock division selection
+#define MCLK_DIVIDE_1                        0x00         //Chip default
+#define MCLK_DIVIDE_2                        0x10
+#define MCLK_DIVIDE_4                        0x80
+#define MCLK_DIVIDE_8                        0xC0
+
+//SMCLK clock source selection
+#define SMCLK_SOURCE_DCOCLK                  0x00         //Chip default
+#define SMCLK_SOURCE_XT2CLK                  0x08
+
+//SMCLK clock division selection
+#define SMCLK_DIVIDE_1                       0x00         //Chip default
+#define SMCLK_DIVIDE_2                       0x02
+#define SMCLK_DIVIDE_4                       0x04
+#define SMCLK_DIVIDE_8                       0x06
+
+//XT2S Frequency range selection
+#define XT2S_RANGE_1MHZ                      0x00         //0.4 to 1-MHz crystal or resonator (Chip default)
+#define XT2S_RANGE_3MHZ                      0x40         //1.0 to 3-MHz crystal or resonator
+#define XT2S_RANGE_16MHZ                     0x80         //3.0 to 16-MHz crystal or resonator
+#define XT2S_RANGE_DIGITAL_SRC               0xC0         //Digital external 0.4- to 16-MHz clock source
+
+//Low-frequency clock select and LFXT1 range select. These bits select between LFXT1 and VLO when XTS =
+//0, and select the frequency range for LFXT1 when XTS = 1.
+//When XTS = 0:
+//00 32768-Hz crystal on LFXT1
+//01 Reserved
+//10 VLOCLK (Reserved in MSP430F21x1 devices)
+//11 Digital external clock source
+//When XTS = 1 (Not applicable for MSP430x20xx devices, MSP430G2xx1/2/3)
+//00 0.4- to 1-MHz crystal or resonator
+//01 1- to 3-MHz crystal or resonator
+//10 3- to 16-MHz crystal or resonator
+//11 Digital external 0.4- to 16-MHz clock source
+
+#define LFXT1S_RANGE_1MHZ                    0x00
+#define LFXT1S_RANGE_3MHZ                    0x10
+#define LFXT1S_RANGE_16MHZ                   0x20
+#define LFXT1S_RANGE_DIGITAL_SRC             0x30
+
+//XT2S internal clock capacitor config
+#define XCAP_1PF                             0x00
+#define XCAP_6PF                             0x04
+#define XCAP_10PF                            0x08
+#define XCAP_12_5PF                          0x0C
+
+//XT2S and LFXT1 clock fault flag mask
+#define XT2S_FAULT_MASK                      0x02
+#define LFXT1_FAULT_MASK                     0x01
+
+//Oscillator fault interrupt enable and flag mask, IE1 and IFG1 register
+#define SFR_OSC_FAULT_MASK                   0x02
+
+//Clock register configuration defined here, this constant is loaded to the register
+//on start up.
+
+#define DCOCTL_STARTUP_CONFIG                CAL_DCOCTL_1MHZ
+#define BCSCTL1_STARTUP_CONFIG               (CAL_BCSCTL1_1MHZ + XT2S_OFF + XTS_LOW_FREQUENCY + ACLK_DIVIDE_1)
+#define BCSCTL2_STARTUP_CONFIG               (MCLK_SOURCE_DEFAULT + MCLK_DIVIDE_1 + SMCLK_SOURCE_DCOCLK + SMCLK_DIVIDE_1)
+#define BCSCTL3_STARTUP_CONFIG               (XT2S_RANGE_1MHZ + LFXT1S_RANGE_1MHZ + XCAP_1PF)
+
+//*****************************************************************************
+//
+// Flash memory controller register addresses and constants defined here.
+//
+//*****************************************************************************
+
+#define FLASH_FCTL1_REG_ADDR                 (0x0128)
+#define FLASH_FCTL2_REG_ADDR                 (0x012A)
+#define FLASH_FCTL3_REG_ADDR                 (0x012C)
+
+//Information memory segment size, a segment is the smallest erasable unit
+#define INFO_SEGMENT_SIZE                    64
+
+//Flash timing generator target, must stay within 257kHz to 476kHz
+#define FLASH_TIMING_HZ                      400000
+
+//Flash timing generator clock divider mask
+#define FLASH_DIVIDER_MASK                   0x003F
+
+//*****************************************************************************
+//
+// Watchdog timer register addresses and constants defined here.
+//
+//*****************************************************************************
+
+#define WATCHDOG_CONTROL_REG_ADDR            (0x0120)
+
+//Watchdog control password, writes without it cause a reset. Reads return
+//0x69 in the upper byte
+#define WATCHDOG_PASSWORD                    0x5A00
+#define WATCHDOG_CONFIG_MASK                 0x00FF
+
+//Watchdog control bits
+#define WATCHDOG_HOLD                        0x0080
+#define WATCHDOG_INTERVAL_MODE               0x0010
+#define WATCHDOG_COUNTER_CLEAR               0x0008
+#define WATCHDOG_SOURCE_SMCLK                0x0000
+#define WATCHDOG_SOURCE_ACLK                 0x0004
+
+//Watchdog interval select, in clock periods
+#define WATCHDOG_INTERVAL_32768              0x0000
+#define WATCHDOG_INTERVAL_8192               0x0001
+#define WATCHDOG_INTERVAL_512                0x0002
+#define WATCHDOG_INTERVAL_64                 0x0003
+
+//Watchdog interrupt enable and flag mask, IE1 and IFG1 register. The flag is
+//also set by a watchdog reset and kept through it
+#define SFR_WATCHDOG_MASK                    0x01
+
+//Reset cause flags, IFG1 register
+#define SFR_POWER_ON_RESET_MASK              0x04
+#define SFR_PIN_RESET_MASK                   0x08
+
+//*****************************************************************************
+//
+// Timer peripheral control register base addresses, offset and constants 
+// defined here.
+//
+//*****************************************************************************
+
+#define TIMERA_TACTL_REG_ADDR                (0x0160)
+#define TIMERA_TAR_REG_ADDR                  (0x0170)
+#define TIMERA_TACCTL0_REG_ADDR              (0x0162)
+#define TIMERA_TACCR0_REG_ADDR               (0x0172)
+#define TIMERA_TACCTL1_REG_ADDR              (0x0164)
+#define TIMERA_TACCR1_REG_ADDR               (0x0174)
+#define TIMERA_TACCTL2_REG_ADDR              (0x0166)
+#define TIMERA_TACCR2_REG_ADDR               (0x0176)
+#define TIMERA_TAIV_REG_ADDR                 (0x012E)
+
+//Timer A clock source select
+#define TIMERA_SOURCE_TACLK                   0x0000
+#define TIMERA_SOURCE_ACLK                    0x0100
+#define TIMERA_SOURCE_SMCLK                   0x0200
+#define TIMERA_SOURCE_INCLK                   0x0C00
+
+//Timer A clock division
+#define TIMERA_DIVIDE_1                       0x0000
+#define TIMERA_DIVIDE_2                       0x0040
+#define TIMERA_DIVIDE_4                       0x0080
+#define TIMERA_DIVIDE_8                       0x0C00
+
+//Timer A operating mode
+#define TIMERA_MODE_STOP                      0x0000
+#define TIMERA_MODE_UPMODE                    0x0010
+#define TIMERA_MODE_CONTINUOUS                0x0020
+#define TIMERA_MODE_UPDOWN                    0x0030
+
+//Timer A Capture/Compare modes
+#define TIMERA_NO_CAPTURE                     0x0000
+#define TIMERA_CAP_RISING                     0x4000
+#define TIMERA_CAP_FALLING                    0x8000
+#define TIMERA_CAP_ALL                        0xC000
+
+//Timer A capture modes
+#define TIMERA_COMPARE_MODE                   0x0000
+#define TIMERA_CAPTURE_MODE                   0x0100
+
+//Timer A capture input select, CCI0B is ACLK
+#define TIMERA_CCIS_A                         0x0000
+#define TIMERA_CCIS_B                         0x1000
+
+//Timer A output modes, the TA0.1 output is also the ADC10 sample trigger
+#define TIMERA_OUTMOD_OUT                     0x0000    //Output follows the OUT bit
+#define TIMERA_OUTMOD_SET                     0x0020    //Output set on compare
+#define TIMERA_OUT_MASK                       0x0004
+
+//Timer A synchronous capture mask
+#define TIMERA_SCS_MASK                       0x0800
+
+//Capture and Compare interrupt enable mask
+#define TIMERA_CCIE_MASK                      0x0010
+
+//Capture and Compare interrupt flag mask
+#define TIMERA_CCIFG_MASK                     0x0001
+#define TIMERA_TAIV_CCR1_CCIFG                0x0002
+#define TIMERA_TAIV_CCR2_CCIFG                0x0004
+#define TIMERA_TAIV_TAIFG                     0x000A
+
+//Timer A interrupt enable mask
+#define TIMERA_TAIE_MASK                      0x0002
+
+//Timer A interrupt flag mask
+#define TIMERA_TAIFG_MASK                     0x0001
+
+//Timer A clear bit mask
+#define TIMERA_TACLR_MASK                     0x0004
+
+//*****************************************************************************
+//
+// ADC10 register addresses and constants defined here.
+//
+//*****************************************************************************
+
+#define ADC10_CTL0_REG_ADDR                  (0x01B0)
+#define ADC10_CTL1_REG_ADDR                  (0x01B2)
+#define ADC10_MEM_REG_ADDR                   (0x01B4)
+#define ADC10_SA_REG_ADDR                    (0x01BC)
+#define ADC10_DTC0_REG_ADDR                  (0x0048)
+#define ADC10_DTC1_REG_ADDR                  (0x0049)
+#define ADC10_AE0_REG_ADDR                   (0x004A)
+
+//ADC10CTL0 control bits, all but ADC10SC, ENC, ADC10IFG and ADC10IE may only
+//be changed with ENC clear
+#define ADC10_START_CONVERSION               0x0001
+#define ADC10_ENABLE_CONVERSION              0x0002
+#define ADC10_IFG_MASK                       0x0004
+#define ADC10_IE_MASK                        0x0008
+#define ADC10_ON                             0x0010
+#define ADC10_MULTIPLE_SAMPLE                0x0080
+
+//ADC10 reference select
+#define ADC10_REF_AVCC                       0x0000
+
+//ADC10 sample and hold time, in ADC10CLK periods
+#define ADC10_SAMPLE_HOLD_4                  0x0000
+#define ADC10_SAMPLE_HOLD_8                  0x0800
+#define ADC10_SAMPLE_HOLD_16                 0x1000
+#define ADC10_SAMPLE_HOLD_64                 0x1800
+
+//ADC10 conversion time in ADC10CLK periods, after the sample and hold time
+#define ADC10_CONVERSION_CLOCKS              13
+
+//ADC10CTL1 busy flag
+#define ADC10_BUSY_MASK                      0x0001
+
+//ADC10 conversion sequence mode, a sequence runs from the selected channel
+//down to A0
+#define ADC10_SEQUENCE_SINGLE                0x0000
+#define ADC10_SEQUENCE_CHANNELS              0x0002
+#define ADC10_SEQUENCE_REPEAT_SINGLE         0x0004
+#define ADC10_SEQUENCE_REPEAT_CHANNELS       0x0006
+#define ADC10_SEQUENCE_MASK                  0x0006
+
+//ADC10 sample and hold trigger, conversions start on the rising edge
+#define ADC10_TRIGGER_SOFTWARE               0x0000
+#define ADC10_TRIGGER_TIMERA_OUT1            0x0400
+#define ADC10_TRIGGER_TIMERA_OUT0            0x0800
+#define ADC10_TRIGGER_MASK                   0x0C00
+
+//ADC10 clock source select
+#define ADC10_SOURCE_ADC10OSC                0x0000
+#define ADC10_SOURCE_ACLK                    0x0008
+#define ADC10_SOURCE_MCLK                    0x0010
+#define ADC10_SOURCE_SMCLK                   0x0018
+#define ADC10_SOURCE_MASK                    0x0018
+
+//ADC10 clock division, divides by 1 to 8
+#define ADC10_DIVIDE_SHIFT                   5
+#define ADC10_DIVIDE(n)                      (((n) - 1) << ADC10_DIVIDE_SHIFT)
+
+//ADC10 input channel select, channels A0 to A7 are the P1 pins
+#define ADC10_CHANNEL_SHIFT                  12
+#define ADC10_MAX_CHANNEL                    15
+#define ADC10_MAX_EXTERNAL_CHANNEL           7
+
+//ADC10 nominal oscillator frequency, varies from 3.7MHz to 6.3MHz
+#define ADC10_OSC_HZ                         5000000
+
+//ADC10DTC0 data transfer control bits
+#define ADC10_DTC_BLOCK_ONE                  0x02    //Block one filled last in two block mode
+#define ADC10_DTC_CONTINUOUS                 0x04
+#define ADC10_DTC_TWO_BLOCK                  0x08
+
+//Largest data transfer block, in conversion results
+#define ADC10_DTC_MAX_BLOCK                  255
+
+//*****************************************************************************
+//
+// USI register addresses and constants defined here.
+//
+//*****************************************************************************
+
+#define USI_CTL0_REG_ADDR                    (0x0078)
+#define USI_CTL1_REG_ADDR                    (0x0079)
+#define USI_CKCTL_REG_ADDR                   (0x007A)
+#define USI_CNT_REG_ADDR                     (0x007B)
+#define USI_SRL_REG_ADDR                     (0x007C)
+#define USI_SRH_REG_ADDR                     (0x007D)
+
+//USICTL0 control bits, the USI is held in reset while USISWRST is set
+#define USI_SOFTWARE_RESET                   0x01
+#define USI_OUTPUT_ENABLE                    0x02
+#define USI_MASTER                           0x08
+#define USI_LSB_FIRST                        0x10
+
+//USI port enables, the pins are taken from the port with no PxSEL setting
+#define USI_PORT_SCLK                        0x20    //P1.5
+#define USI_PORT_SDO                         0x40    //P1.6
+#define USI_PORT_SDI                         0x80    //P1.7
+
+//USICTL1 control bits, USIIFG is set when the bit counter reaches zero and
+//cleared by writing the bit counter
+#define USI_IFG_MASK                         0x01
+#define USI_IE_MASK                          0x10
+#define USI_CLOCK_PHASE                      0x80    //Data captured on the first clock edge
+
+//USICKCTL clock source select and clock polarity
+#define USI_SOURCE_ACLK                      0x04
+#define USI_SOURCE_SMCLK                     0x08
+#define USI_SOURCE_MASK                      0x1C
+#define USI_CLOCK_POLARITY                   0x02    //Clock idles high
+
+//USI clock division, divides by 2^n for n of 0 to 7
+#define USI_DIVIDE_SHIFT                     5
+#define USI_DIVIDE(n)                        ((n) << USI_DIVIDE_SHIFT)
+
+//USICNT bit counter, up to 31 bits with the 16 bit shift register
+#define USI_COUNT_MASK                       0x1F
+#define USI_16BIT                            0x40
+
+//*****************************************************************************
+//
+// Hardware error codes
+//
+//*****************************************************************************
+
+#define HW__EXT_CLOCK_FAULT                   1
+#define HW__INVALID_DCO_FREQUENCY             2
+#define HW__DCO_NOT_CALIBRATED                3
+
+//Reference clock frequency, LFXT1 watch crystal sourcing ACLK undivided
+#define HW__ACLK_HZ                           32768
+
+//Crystal start up allowed during boot, in polls of the oscillator fault flag.
+//Boot carries on from the DCO if the crystal has not settled by then, the
+//start up is completed in the background by HW__PollCrystal.
+#define HW__CRYSTAL_STARTUP_POLLS             10
+#define HW__CRYSTAL_POLL_CYCLES               5000
+
+//*****************************************************************************
+//
+// Calibrated DCO frequencies, MCLK and SMCLK both run undivided from the DCO.
+// 16MHz operation requires VCC of at least 3.3V.
+//
+//*****************************************************************************
+
+enum
+{
+    HW__DCO_1MHZ = 0,
+    HW__DCO_8MHZ,
+    HW__DCO_12MHZ,
+    HW__DCO_16MHZ,
+    HW__NUM_DCO_FREQUENCIES
+};
+
+//*****************************************************************************
+//
+// Clock users registered here. A user may be notified of Timer A clock
+// frequency changes and may request clocks to be kept running while idle.
+//
+//*****************************************************************************
+
+enum
+{
+    HW__CLOCK_USER_SOFTTMR = 0,
+    HW__CLOCK_USER_UPTIME,
+    HW__CLOCK_USER_DCOCAL,
+    HW__CLOCK_USER_ADC,
+    HW__CLOCK_USER_SPI,
+    HW__CLOCK_USER_GPIO,
+    HW__NUM_CLOCK_USERS
+};
+
+//Clock requests, the idle path enters the deepest low power mode that keeps
+//every requested clock running
+#define HW__CLOCK_NONE                        0x00
+#define HW__CLOCK_SMCLK                       0x01    //Limits idle to LPM0, keeps Timer A on SMCLK
+#define HW__CLOCK_ACLK                        0x02    //Limits idle to LPM3
+#define HW__CLOCK_ADC10OSC                    0x04    //Runs on request of the ADC10 in any mode
+#define HW__CLOCK_TIMERA                      0x08    //Timer A counting, moved onto ACLK when SMCLK is not requested
+
+//Timer A clock source select mask
+#define HW__TIMERA_SOURCE_MASK                0x0300
+
+//Called with interrupts disabled straight after the Timer A clock frequency
+//has changed, either by a DCO switch or by moving Timer A between SMCLK and ACLK
+//timer_hz - New Timer A clock frequency
+typedef void (*HW__ClockHandler_t)(uint32_t timer_hz);
+
+//*****************************************************************************
+//
+// Macros for hardware memory address access
+//
+//*****************************************************************************
+#ifndef MYLIB_HOST_SIM
+#define HWREG32(x)                                                              \
+    (*((volatile uint32_t *)((uint16_t)x)))
+#define HWREG16(x)                                                             \
+    (*((volatile uint16_t *)((uint16_t)x)))
+#define HWREG8(x)                                                             \
+    (*((volatile uint8_t *)((uint16_t)x)))
+#else
+//Host build, registers are held in the simulated register file
+#define HWREG32(x)                                                              \
+    (*HOSTSIM__Register32((uint16_t)(x)))
+#define HWREG16(x)                                                             \
+    (*HOSTSIM__Register16((uint16_t)(x)))
+#define HWREG8(x)                                                             \
+    (*HOSTSIM__Register8((uint16_t)(x)))
+#endif
+
+//Address of a RAM buffer as seen by the ADC10 data transfer controller. Host
+//buffers are mapped into the simulated address space.
+#ifndef MYLIB_HOST_SIM
+#define HW__DTC_ADDRESS(buffer, size)                                          \
+    ((uint16_t)(buffer))
+#else
+#define HW__DTC_ADDRESS(buffer, size)                                          \
+    HOSTSIM__MapAddress((buffer), (size))
+#endif
+
+//*****************************************************************************
+//
+// Function prototypes defined here
+//
+//*****************************************************************************
+
+void HW__InitialiseSystem(void);
+void HW__EnterLowpower(void);
+void HW__EnterDeepSleep(void);
+void HW__RegisterClockHandler(uint8_t user, HW__ClockHandler_t handler);
+void HW__SetDcoFrequency(uint8_t frequency);
+void HW__WriteDcoSetting(uint8_t dcoctl, uint8_t bcsctl1);
+uint32_t HW__GetDcoFrequencyHz(uint8_t frequency);
+uint32_t HW__GetSmclkFrequency(void);
+uint32_t HW__GetTimerClockFrequency(void);
+void HW__RequestClocks(uint8_t user, uint8_t clocks);
+bool HW__IsLowpowerStale(void);
+bool HW__IsCrystalRunning(void);
+bool HW__PollCrystal(void);
+void HW__OscillatorFaultHandler(void);
+void HW__WriteInfoSegment(uint16_t address, const uint8_t *data, uint8_t length);
+
+#endif  //__HARDWARE_CTL__
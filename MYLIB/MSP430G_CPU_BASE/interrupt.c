@@ -1,230 +1,563 @@
-// *****************************************************************************
-// *  File: interrupt.c
-// *
-// *  Purpose:                                                                         
-// *  This file contains functions for the control interrupt flags and registers.
-// *  Interrupt handler functions may be defined here or in individual driver
-// *  code. 
-// * 
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 27/08/2016  
-// *
-// *
-// *
-// *****************************************************************************
-
-#include "interrupt.h"
-#include "hardware_ctl.h"
-#include "onemillisecond_ctl.h"
-#include "tenmillisecond_ctl.h"
-#include "gpio.h"
-
-//*****************************************************************************
-//
-// Interrupt vector callbacks are defined here, handler functions may be 
-// defined in individual driver source code.
-//
-//*****************************************************************************
-
-#if defined PORT1_VECTOR
-
-// Port 1 GPIO interrupt vector call
-#pragma vector = PORT1_VECTOR
-__interrupt void GPIO_PORT1_Handler(void) 
-{
-  	GPIO_Port1_Event_Handler();
-}
-
-#else
-  	#error "interrupt.c: Port 1 not available!"
-#endif
-
-#if defined PORT2_VECTOR
-
-// Port 2 GPIO interrupt vector call 
-#pragma vector = PORT2_VECTOR
-__interrupt void GPIO_PORT2_Handler(void) 
-{
-  	GPIO_Port2_Event_Handler();
-}
-
-#else
-  	#error "interrupt.c: Port 2 not available!"
-#endif
-
-#if defined TIMERA0_VECTOR
-
-// TimerA0 interrupt vector call
-#pragma vector = TIMERA0_VECTOR
-__interrupt void TIMERA0_HANDLER(void) 
-{
-#ifdef COMPILED_ONEMS_CTL	
-	OneMilliSecondEventHandler();
-#endif
-}
-
-#else
-	#error "interrupt.c: TimerA0 not available!"
-#endif
-
-#if defined TIMERA1_VECTOR
-
-// TimerA1 interrupt vector call
-#pragma vector = TIMERA1_VECTOR
-__interrupt void TIMERA1_HANDLER(void) 
-{
-#ifdef COMPILED_TENMS_CTL
-	TenMilliSecondEventHandler();
-#endif
-}
-
-#else
-	#error "interrupt.c: TimerA1 not available!"
-#endif
-
-
-// Additional interrupt vector callbacks to be defined here as working progress
-
-//*****************************************************************************
-//
-// Purpose: Inline function to set the IO enable interrupt bits.
-// Argument: int_id - interrupt ID identifier
-// 					 setting - (DISABLE_INT) disable specified interrupt bit  
-//							 - (ENABLE_IN) enable specified interrupt bit
-// Return: None
-//
-//*****************************************************************************
-
-static inline void set_IO_interrupt(uint8_t int_id, uint8_t setting) 
-{
-	uint16_t base_address;
-
-	if(int_id < IO_INT_7) 
-	{
-		base_address = PORT1_IE_REG_ADDR;
-	}
-	else 
-	{
-		base_address = PORT2_IE_REG_ADDR;
-	}
-
-	//Write to IO interrupt enable hardware register
-	if(setting == ENABLE_INT) 
-	{
-		HWREG8(base_address) |= (1 << int_id);
-	}
-	else 
-	{
-		HWREG8(base_address) &= ~(1 << int_id);
-	}
-}
-
-//*****************************************************************************
-// Function: INT__Enable(uint8_t int_id)
-// Purpose: Interrupt enable for various peripherals are to be done by this function. 
-// Argument: int_id - interrupt ID identifier
-// Return: None
-//
-//*****************************************************************************
-
-void INT__Enable(uint8_t int_id) 
-{
-	uint8_t temp = 0;
-
-	//All IO interrupt ID can be mapped to one
-	if(int_id <= IO_INT_13) 
-	{
-		temp = int_id;
-		int_id = IO_INT;
-	}
-
-	switch(int_id) 
-	{
-		case IO_INT:
-			set_IO_interrupt(temp, ENABLE_INT);
-			break;
-		case TIMERA_INT:
-			HWREG16(TIMERA_TACTL_REG_ADDR) |= TIMERA_TAIE_MASK;
-			break;
-		case TIMERA_CC0_INT:
-			HWREG16(TIMERA_TACCTL0_REG_ADDR) |= TIMERA_CCIE_MASK;
-			break;
-		case TIMERA_CC1_INT:
-			HWREG16(TIMERA_TACCTL1_REG_ADDR) |= TIMERA_CCIE_MASK;
-			break;	 
-		case TIMERA_CC2_INT:
-			HWREG16(TIMERA_TACCTL2_REG_ADDR) |= TIMERA_CCIE_MASK;
-			break;
-		default:
-			LIBUTIL__LogError(INT__INVALID_INTERRUPT_ID);
-	}
-}
-
-//*****************************************************************************
-// Function: INT__Disable(uint8_t int_id)
-// Purpose: Interrupt disable for various peripherals are to be done by this function. 
-// Argument: int_id - interrupt ID identifier
-// Return: None
-//
-//*****************************************************************************
-
-void INT__Disable(uint8_t int_id) 
-{
-	uint8_t temp = 0;
-
-	//All IO interrupt ID can be mapped to one
-	if(int_id <= IO_INT_13) 
-	{
-		temp = int_id;
-		int_id = IO_INT;
-	}
-
-	switch(int_id) 
-	{
-		case IO_INT:
-			set_IO_interrupt(temp, DISABLE_INT);
-			break;
-		case TIMERA_INT:
-			HWREG16(TIMERA_TACTL_REG_ADDR) &= ~TIMERA_TAIE_MASK;
-			break;
-		case TIMERA_CC0_INT:
-			HWREG16(TIMERA_TACCTL0_REG_ADDR) &= ~TIMERA_CCIE_MASK;
-			break;
-		case TIMERA_CC1_INT:
-			HWREG16(TIMERA_TACCTL1_REG_ADDR) &= ~TIMERA_CCIE_MASK;
-			break;	 
-		case TIMERA_CC2_INT:
-			HWREG16(TIMERA_TACCTL2_REG_ADDR) &= ~TIMERA_CCIE_MASK;
-			break;	
-		default:
-			LIBUTIL__LogError(INT__INVALID_INTERRUPT_ID);
-	}
-}
-
-//*****************************************************************************
-// Function: INT__EnableInterrupts(void)
-// Purpose: Enable interrupt generation
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void INT__EnableInterrupts(void) 
-{
-	_enable_interrupts();		//Write to CPU status register to enable general interrupts
-}
-
-//*****************************************************************************
-// Function: INT__DisableInterrupts(void)
-// Purpose: Disable interrupt generation
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void INT__DisableInterrupts(void) 
-{
-	_disable_interrupts();		//Write to CPU status register to enable general interrupts
-}
-
+// *****************************************************************************
+// *  File: interrupt.c
+// *
+// *  Purpose:                                                                         
+// *  This file contains functions for the control interrupt flags and registers.
+// *  Interrupt handler functions may be defined here or in individual driver
+// *  code. 
+// * 
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 27/08/2016  
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "interrupt.h"
+#include "hardware_ctl.h"
+#include "softtimer_ctl.h"
+#include "gpio.h"
+#include "scheduler.h"
+#include "uptime_ctl.h"
+#include "watchdog_ctl.h"
+#include "adc_ctl.h"
+#include "spi_ctl.h"
+
+//*****************************************************************************
+//
+// Interrupt handler run time measurement, Timer A is sampled on handler entry
+// and exit. Compiled out unless INT__ISR_STATS is defined.
+//
+//*****************************************************************************
+
+#ifdef INT__ISR_STATS
+
+static INT__IsrStats_t IsrStats[INT__NUM_STATS];
+
+static inline void recordIsrTime(INT__IsrStats_t *stats, uint16_t duration)
+{
+	//Count and total stop together so the average stays valid
+	if(stats->count != 0xFFFF)
+	{
+		stats->count++;
+		stats->total += duration;
+	}
+
+	if(duration < stats->min)
+	{
+		stats->min = duration;
+	}
+
+	if(duration > stats->max)
+	{
+		stats->max = duration;
+	}
+}
+
+#define ISR_STATS_ENTRY()		uint16_t isr_start = HWREG16(TIMERA_TAR_REG_ADDR)
+#define ISR_STATS_EXIT(id)		recordIsrTime(&IsrStats[id], HWREG16(TIMERA_TAR_REG_ADDR) - isr_start)
+
+#else
+
+#define ISR_STATS_ENTRY()
+#define ISR_STATS_EXIT(id)
+
+#endif
+
+//*****************************************************************************
+//
+// Interrupt vector callbacks are defined here, handler functions may be 
+// defined in individual driver source code.
+//
+//*****************************************************************************
+
+#if defined PORT1_VECTOR
+
+// Port 1 GPIO interrupt vector call
+#pragma vector = PORT1_VECTOR
+__interrupt void GPIO_PORT1_Handler(void) 
+{
+	ISR_STATS_ENTRY();
+
+  	GPIO_Port1_Event_Handler();
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_PORT1);
+}
+
+#else
+  	#error "interrupt.c: Port 1 not available!"
+#endif
+
+#if defined PORT2_VECTOR
+
+// Port 2 GPIO interrupt vector call 
+#pragma vector = PORT2_VECTOR
+__interrupt void GPIO_PORT2_Handler(void) 
+{
+	ISR_STATS_ENTRY();
+
+  	GPIO_Port2_Event_Handler();
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_PORT2);
+}
+
+#else
+  	#error "interrupt.c: Port 2 not available!"
+#endif
+
+#if defined TIMERA0_VECTOR
+
+// TimerA0 interrupt vector call
+#pragma vector = TIMERA0_VECTOR
+__interrupt void TIMERA0_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+#ifdef COMPILED_SOFTTMR_CTL
+	SOFTTMR__EventHandler();
+
+	//Hand expired timer callbacks over to the scheduler
+	if(SOFTTMR__CallbackPending())
+	{
+		SCHED__Post(SCHED__SOFTTMR_TASK, SCHED__EVENT_SOFTTMR_CALLBACK);
+	}
+#endif
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_TIMERA0);
+}
+
+#else
+	#error "interrupt.c: TimerA0 not available!"
+#endif
+
+#if defined TIMERA1_VECTOR
+
+// TimerA1 interrupt vector call
+#pragma vector = TIMERA1_VECTOR
+__interrupt void TIMERA1_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+	//Reading TAIV clears the highest priority pending flag, soft timers run
+	//from TACCR0 and timed ADC10 sampling from TACCR1
+	switch(HWREG16(TIMERA_TAIV_REG_ADDR))
+	{
+		case TIMERA_TAIV_CCR1_CCIFG:
+#ifdef COMPILED_ADC_CTL
+			ADC__SampleClockHandler();
+#endif
+			break;
+
+		case TIMERA_TAIV_TAIFG:
+#ifdef COMPILED_UPTIME_CTL
+			UPTIME__OverflowHandler();
+#endif
+			break;
+
+		default:
+			break;
+	}
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_TIMERA1);
+}
+
+#else
+	#error "interrupt.c: TimerA1 not available!"
+#endif
+
+#if defined NMI_VECTOR
+
+// NMI vector call, only the oscillator fault source is enabled
+#pragma vector = NMI_VECTOR
+__interrupt void NMI_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+	if(HWREG8(SFR_INTERRUPT_FLAG_REG_ADDR) & SFR_OSC_FAULT_MASK)
+	{
+		HW__OscillatorFaultHandler();
+
+		//Wake the idle loop so the low power mode is chosen again for the
+		//clock Timer A now runs from
+		LPM4_EXIT;
+	}
+	else if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		//Wake the scheduler if the handler posted task events or released a
+		//clock the low power mode was chosen for
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_NMI);
+}
+
+#else
+	#error "interrupt.c: NMI not available!"
+#endif
+
+#if defined WDT_VECTOR
+
+// Watchdog interval timer vector call
+#pragma vector = WDT_VECTOR
+__interrupt void WDT_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+#ifdef COMPILED_WATCHDOG_CTL
+	WATCHDOG__IntervalHandler();
+#endif
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_WDT);
+}
+
+#else
+	#error "interrupt.c: Watchdog not available!"
+#endif
+
+#if defined ADC10_VECTOR
+
+// ADC10 vector call, raised once per data transfer block
+#pragma vector = ADC10_VECTOR
+__interrupt void ADC10_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+#ifdef COMPILED_ADC_CTL
+	ADC__BlockHandler();
+#endif
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_ADC10);
+}
+
+#else
+	#error "interrupt.c: ADC10 not available!"
+#endif
+
+#if defined USI_VECTOR
+
+// USI vector call, raised once the bit counter has shifted a whole byte
+#pragma vector = USI_VECTOR
+__interrupt void USI_HANDLER(void) 
+{
+	ISR_STATS_ENTRY();
+
+#ifdef COMPILED_SPI_CTL
+	SPI__TransferHandler();
+#endif
+
+	//Wake the scheduler if the handler posted task events or released a clock
+	//the low power mode was chosen for
+	if(SCHED__TaskReady() || HW__IsLowpowerStale())
+	{
+		LPM4_EXIT;
+	}
+
+	ISR_STATS_EXIT(INT__STATS_USI);
+}
+
+#else
+	#error "interrupt.c: USI not available!"
+#endif
+
+
+// Additional interrupt vector callbacks to be defined here as working progress
+
+//*****************************************************************************
+//
+// Purpose: Inline function to set the IO enable interrupt bits.
+// Argument: int_id - interrupt ID identifier
+// 					 setting - (DISABLE_INT) disable specified interrupt bit  
+//							 - (ENABLE_IN) enable specified interrupt bit
+// Return: None
+//
+//*****************************************************************************
+
+static inline void set_IO_interrupt(uint8_t int_id, uint8_t setting) 
+{
+	uint16_t base_address;
+
+	if(int_id < IO_INT_7) 
+	{
+		base_address = PORT1_IE_REG_ADDR;
+	}
+	else 
+	{
+		base_address = PORT2_IE_REG_ADDR;
+	}
+
+	//Write to IO interrupt enable hardware register
+	if(setting == ENABLE_INT) 
+	{
+		HWREG8(base_address) |= (1 << int_id);
+	}
+	else 
+	{
+		HWREG8(base_address) &= ~(1 << int_id);
+	}
+}
+
+//*****************************************************************************
+// Function: INT__Enable(uint8_t int_id)
+// Purpose: Interrupt enable for various peripherals are to be done by this function. 
+// Argument: int_id - interrupt ID identifier
+// Return: None
+//
+//*****************************************************************************
+
+void INT__Enable(uint8_t int_id) 
+{
+	uint8_t temp = 0;
+
+	//All IO interrupt ID can be mapped to one
+	if(int_id <= IO_INT_13) 
+	{
+		temp = int_id;
+		int_id = IO_INT;
+	}
+
+	switch(int_id) 
+	{
+		case IO_INT:
+			set_IO_interrupt(temp, ENABLE_INT);
+			break;
+		case TIMERA_INT:
+			HWREG16(TIMERA_TACTL_REG_ADDR) |= TIMERA_TAIE_MASK;
+			break;
+		case TIMERA_CC0_INT:
+			HWREG16(TIMERA_TACCTL0_REG_ADDR) |= TIMERA_CCIE_MASK;
+			break;
+		case TIMERA_CC1_INT:
+			HWREG16(TIMERA_TACCTL1_REG_ADDR) |= TIMERA_CCIE_MASK;
+			break;	 
+		case TIMERA_CC2_INT:
+			HWREG16(TIMERA_TACCTL2_REG_ADDR) |= TIMERA_CCIE_MASK;
+			break;
+		case OSC_FAULT_INT:
+			HWREG8(SFR_INTERRUPT_EN_REG_ADDR) |= SFR_OSC_FAULT_MASK;
+			break;
+		case WATCHDOG_INT:
+			HWREG8(SFR_INTERRUPT_EN_REG_ADDR) |= SFR_WATCHDOG_MASK;
+			break;
+		case ADC10_INT:
+			HWREG16(ADC10_CTL0_REG_ADDR) |= ADC10_IE_MASK;
+			break;
+		case USI_INT:
+			HWREG8(USI_CTL1_REG_ADDR) |= USI_IE_MASK;
+			break;
+		default:
+			LIBUTIL__LogError(INT__INVALID_INTERRUPT_ID);
+	}
+}
+
+//*****************************************************************************
+// Function: INT__Disable(uint8_t int_id)
+// Purpose: Interrupt disable for various peripherals are to be done by this function. 
+// Argument: int_id - interrupt ID identifier
+// Return: None
+//
+//*****************************************************************************
+
+void INT__Disable(uint8_t int_id) 
+{
+	uint8_t temp = 0;
+
+	//All IO interrupt ID can be mapped to one
+	if(int_id <= IO_INT_13) 
+	{
+		temp = int_id;
+		int_id = IO_INT;
+	}
+
+	switch(int_id) 
+	{
+		case IO_INT:
+			set_IO_interrupt(temp, DISABLE_INT);
+			break;
+		case TIMERA_INT:
+			HWREG16(TIMERA_TACTL_REG_ADDR) &= ~TIMERA_TAIE_MASK;
+			break;
+		case TIMERA_CC0_INT:
+			HWREG16(TIMERA_TACCTL0_REG_ADDR) &= ~TIMERA_CCIE_MASK;
+			break;
+		case TIMERA_CC1_INT:
+			HWREG16(TIMERA_TACCTL1_REG_ADDR) &= ~TIMERA_CCIE_MASK;
+			break;	 
+		case TIMERA_CC2_INT:
+			HWREG16(TIMERA_TACCTL2_REG_ADDR) &= ~TIMERA_CCIE_MASK;
+			break;	
+		case OSC_FAULT_INT:
+			HWREG8(SFR_INTERRUPT_EN_REG_ADDR) &= ~SFR_OSC_FAULT_MASK;
+			break;
+		case WATCHDOG_INT:
+			HWREG8(SFR_INTERRUPT_EN_REG_ADDR) &= ~SFR_WATCHDOG_MASK;
+			break;
+		case ADC10_INT:
+			HWREG16(ADC10_CTL0_REG_ADDR) &= ~ADC10_IE_MASK;
+			break;
+		case USI_INT:
+			HWREG8(USI_CTL1_REG_ADDR) &= ~USI_IE_MASK;
+			break;
+		default:
+			LIBUTIL__LogError(INT__INVALID_INTERRUPT_ID);
+	}
+}
+
+//*****************************************************************************
+// Function: INT__EnableInterrupts(void)
+// Purpose: Enable interrupt generation
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void INT__EnableInterrupts(void) 
+{
+	_enable_interrupts();		//Write to CPU status register to enable general interrupts
+}
+
+//*****************************************************************************
+// Function: INT__DisableInterrupts(void)
+// Purpose: Disable interrupt generation
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void INT__DisableInterrupts(void) 
+{
+	_disable_interrupts();		//Write to CPU status register to enable general interrupts
+}
+
+
+//*****************************************************************************
+// Function: INT__EnterCritical(void)
+// Purpose: Disable interrupt generation for a short critical section, safe to
+//          use from both interrupt handlers and the main loop.
+// Argument: None
+// Return: Interrupt state to be passed to INT__ExitCritical
+//
+//*****************************************************************************
+
+uint16_t INT__EnterCritical(void) 
+{
+	uint16_t state = _get_SR_register() & GIE;	//Save the general interrupt enable state
+
+	_disable_interrupts();
+
+	return state;
+}
+
+//*****************************************************************************
+// Function: INT__ExitCritical(uint16_t state)
+// Purpose: End a critical section, interrupt generation is only re-enabled if
+//          it was enabled when the critical section was entered.
+// Argument: state - Interrupt state returned by INT__EnterCritical
+// Return: None
+//
+//*****************************************************************************
+
+void INT__ExitCritical(uint16_t state) 
+{
+	if(state != 0)
+	{
+		_enable_interrupts();
+	}
+}
+
+#ifdef INT__ISR_STATS
+
+//*****************************************************************************
+// Function: INT__ReadIsrStats(uint8_t stats_id, INT__IsrStats_t *stats)
+// Purpose: Read a consistent copy of the run time statistics of an interrupt
+//          handler.
+// Argument: stats_id - Handler statistics ID
+//           stats - Destination for the statistics
+// Return: None
+//
+//*****************************************************************************
+
+void INT__ReadIsrStats(uint8_t stats_id, INT__IsrStats_t *stats) 
+{
+	uint16_t state;
+
+	if(stats_id < INT__NUM_STATS)
+	{
+		state = INT__EnterCritical();
+		*stats = IsrStats[stats_id];
+		INT__ExitCritical(state);
+	}
+	else
+	{
+		LIBUTIL__LogError(INT__INVALID_INTERRUPT_ID);
+	}
+}
+
+//*****************************************************************************
+// Function: INT__ClearIsrStats(void)
+// Purpose: Reset the run time statistics of all interrupt handlers, to be
+//          called once at start up before the first handler runs.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void INT__ClearIsrStats(void) 
+{
+	uint16_t state = INT__EnterCritical();
+	uint8_t index;
+
+	for(index = 0; index < INT__NUM_STATS; index++)
+	{
+		IsrStats[index].count = 0;
+		IsrStats[index].min = 0xFFFF;
+		IsrStats[index].max = 0;
+		IsrStats[index].total = 0;
+	}
+
+	INT__ExitCritical(state);
+}
+
+#endif
@@ -1,89 +1,143 @@
-// *****************************************************************************
-// *  File: interrupt.h
-// *
-// *  Purpose:                                                                         
-// *  This header file defines all of the interrupt control function primitives
-// *  and constants. Interrupt vectors for the processor may also be defined  
-// *  here.
-// * 
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 11/09/2016  
-// *
-// *
-// *
-// *****************************************************************************
-
-#ifndef __INTERRUPT_H__
-#define __INTERRUPT_H__
-
-#include "libUtility.h"
-#include <stdint.h>
-#include <stdbool.h>
-
-#define COMPILED_INTERRUPT_CTL
-
-//*****************************************************************************
-//
-// Generic constants defined here.  
-//
-//*****************************************************************************
-
-#define DISABLE_INT		0
-#define ENABLE_INT		1
-
-#define INT__INVALID_INTERRUPT_ID   20
-
-
-//*****************************************************************************
-//
-// Base addresses to registers with interrupt enable control are defined here.
-//
-//*****************************************************************************
-
-#define PORT1_IE_REG_ADDR	(MSP430_PORT1_ADDR + OFS_IE)  //Base address to PORT1 P1IE register
-#define PORT2_IE_REG_ADDR	(MSP430_PORT2_ADDR + OFS_IE)  //Base address to PORT2 P2IE register
-
-//*****************************************************************************
-//
-// Interrupt ID defined here, use these to define the interrupt to be configured
-//
-//*****************************************************************************
-
-//GPIO interrupt ID
-
-#define IO_INT_0	0
-#define IO_INT_1	1 
-#define IO_INT_2	2
-#define IO_INT_3	3
-#define IO_INT_4	4
-#define IO_INT_5	5
-#define IO_INT_6	6
-#define IO_INT_7	7
-#define IO_INT_8	8
-#define IO_INT_9	9
-#define IO_INT_10	10
-#define IO_INT_11	11
-#define IO_INT_12	12
-#define IO_INT_13	13
-#define IO_INT 		0
-
-//Timer A interrupt ID
-
-#define TIMERA_INT       14
-#define TIMERA_CC0_INT   15
-#define TIMERA_CC1_INT   16
-#define TIMERA_CC2_INT   17
-
-//*****************************************************************************
-//
-// Function prototype defined here
-// 
-//*****************************************************************************
-
-void INT__Enable(uint8_t int_id);
-void INT__Disable(uint8_t int_id);
-void INT__EnableInterrupts(void);
-void INT__DisableInterrupts(void);
-
-#endif //__INTERRUPT_H__
+// *****************************************************************************
+// *  File: interrupt.h
+// *
+// *  Purpose:                                                                         
+// *  This header file defines all of the interrupt control function primitives
+// *  and constants. Interrupt vectors for the processor may also be defined  
+// *  here.
+// * 
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 11/09/2016  
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef __INTERRUPT_H__
+#define __INTERRUPT_H__
+
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_INTERRUPT_CTL
+
+//*****************************************************************************
+//
+// Generic constants defined here.  
+//
+//*****************************************************************************
+
+#define DISABLE_INT		0
+#define ENABLE_INT		1
+
+#define INT__INVALID_INTERRUPT_ID   20
+
+//Uncomment to measure interrupt handler run time with Timer A, the timer
+//must be clocked from MCLK for the figures to be in CPU cycles. The power
+//manager then keeps Timer A on SMCLK, so idle is limited to LPM0
+//#define INT__ISR_STATS
+
+
+//*****************************************************************************
+//
+// Base addresses to registers with interrupt enable control are defined here.
+//
+//*****************************************************************************
+
+#define PORT1_IE_REG_ADDR	(MSP430_PORT1_ADDR + OFS_IE)  //Base address to PORT1 P1IE register
+#define PORT2_IE_REG_ADDR	(MSP430_PORT2_ADDR + OFS_IE)  //Base address to PORT2 P2IE register
+
+//*****************************************************************************
+//
+// Interrupt ID defined here, use these to define the interrupt to be configured
+//
+//*****************************************************************************
+
+//GPIO interrupt ID
+
+#define IO_INT_0	0
+#define IO_INT_1	1 
+#define IO_INT_2	2
+#define IO_INT_3	3
+#define IO_INT_4	4
+#define IO_INT_5	5
+#define IO_INT_6	6
+#define IO_INT_7	7
+#define IO_INT_8	8
+#define IO_INT_9	9
+#define IO_INT_10	10
+#define IO_INT_11	11
+#define IO_INT_12	12
+#define IO_INT_13	13
+#define IO_INT 		0
+
+//Timer A interrupt ID
+
+#define TIMERA_INT       14
+#define TIMERA_CC0_INT   15
+#define TIMERA_CC1_INT   16
+#define TIMERA_CC2_INT   17
+
+//Oscillator fault interrupt ID
+
+#define OSC_FAULT_INT    18
+
+//Watchdog interval timer interrupt ID
+
+#define WATCHDOG_INT     19
+
+//ADC10 interrupt ID
+
+#define ADC10_INT        20
+
+//USI counter interrupt ID
+
+#define USI_INT          21
+
+//*****************************************************************************
+//
+// Interrupt handler statistics, only available with INT__ISR_STATS defined
+//
+//*****************************************************************************
+
+enum
+{
+	INT__STATS_PORT1 = 0,
+	INT__STATS_PORT2,
+	INT__STATS_TIMERA0,
+	INT__STATS_TIMERA1,
+	INT__STATS_NMI,
+	INT__STATS_WDT,
+	INT__STATS_ADC10,
+	INT__STATS_USI,
+	INT__NUM_STATS
+};
+
+typedef struct {
+	uint16_t count;		//Number of handler calls, saturates at 0xFFFF
+	uint16_t min;		//Shortest handler run time in timer counts, 0xFFFF before the first call
+	uint16_t max;		//Longest handler run time in timer counts
+	uint32_t total;		//Cumulative handler run time in timer counts, of the counted calls
+} INT__IsrStats_t;
+
+//*****************************************************************************
+//
+// Function prototype defined here
+// 
+//*****************************************************************************
+
+void INT__Enable(uint8_t int_id);
+void INT__Disable(uint8_t int_id);
+void INT__EnableInterrupts(void);
+void INT__DisableInterrupts(void);
+uint16_t INT__EnterCritical(void);
+void INT__ExitCritical(uint16_t state);
+
+#ifdef INT__ISR_STATS
+void INT__ReadIsrStats(uint8_t stats_id, INT__IsrStats_t *stats);
+void INT__ClearIsrStats(void);
+#endif
+
+#endif //__INTERRUPT_H__
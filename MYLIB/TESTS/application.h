@@ -0,0 +1,21 @@
+// *****************************************************************************
+// *  File: application.h
+// *
+// *  Purpose:
+// *  Stand in for the application header of a firmware project, lets main.h
+// *  and main.c be compiled by the host build.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _APPLICATION_H_
+#define _APPLICATION_H_
+
+void APPLICATION__Process(void);
+
+#endif //_APPLICATION_H_
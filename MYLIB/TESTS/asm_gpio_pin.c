@@ -0,0 +1,53 @@
+// *****************************************************************************
+// *  File: asm_gpio_pin.c
+// *
+// *  Purpose:
+// *  Pin accesses by GPIO_Pin_t handle and by pin ID for make asm, which
+// *  compiles this file and DRIVERS/gpio.c to assembly and counts the
+// *  instructions of each function. The pin ID forms also run the body of
+// *  GPIO_pinWrite or GPIO_pinRead, counted from gpio.s and added to their
+// *  totals. Compiled without MYLIB_HOST_SIM so the registers are plain
+// *  memory accesses, not linked into the host programs.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "gpio.h"
+
+#define LED_PIN_ID                  GPIO_IOID5
+#define LED_PIN                     GPIO_PIN(LED_PIN_ID)
+
+void WriteByHandle(uint8_t value)
+{
+    GPIO_write(LED_PIN, value);
+}
+
+void WriteById(uint8_t value)
+{
+    GPIO_pinWrite(LED_PIN_ID, value);
+}
+
+void SetByHandle(void)
+{
+    GPIO_set(LED_PIN);
+}
+
+void SetById(void)
+{
+    GPIO_pinWrite(LED_PIN_ID, LOGIC_HIGH);
+}
+
+uint8_t ReadByHandle(void)
+{
+    return GPIO_read(LED_PIN);
+}
+
+uint8_t ReadById(void)
+{
+    return GPIO_pinRead(LED_PIN_ID);
+}
@@ -0,0 +1,172 @@
+// *****************************************************************************
+// *  File: bench_dsp.c
+// *
+// *  Purpose:
+// *  Cost per sample of the DSP kernels on blocks of 32 ADC10 sized samples.
+// *  The simulator only times register accesses and the kernels make none, so
+// *  the cost is host time per sample and, on x86 hosts, host CPU cycles per
+// *  sample from the time stamp counter. The figures rank the kernels against
+// *  each other, the MSP430 cost without a hardware multiplier is higher.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES()               __rdtsc()
+#else
+#define HOST_CYCLES()               0
+#endif
+
+#define BLOCK_LENGTH                32
+#define NUM_BLOCKS                  64
+#define NUM_PASSES                  500
+#define NUM_SAMPLES                 ((uint32_t)BLOCK_LENGTH * NUM_BLOCKS * NUM_PASSES)
+
+typedef enum {
+    KERNEL_CIC,
+    KERNEL_IIR1,
+    KERNEL_IIR2,
+    KERNEL_HIGHPASS,
+    KERNEL_STATS,
+    KERNEL_THRESHOLD,
+    NUM_KERNELS
+} Kernel_t;
+
+typedef struct {
+    const char *name;
+    double ns;
+    double cycles;
+} Cost_t;
+
+// Private variables defined here
+static const char *const KernelNames[NUM_KERNELS] = {
+    "CIC order 3 rate 16",
+    "IIR order 1 shift 4",
+    "IIR order 2 shift 4",
+    "high pass order 2",
+    "statistics",
+    "threshold",
+};
+
+static Cost_t Costs[NUM_KERNELS];
+static int16_t Input[NUM_BLOCKS][BLOCK_LENGTH];
+static int16_t Output[BLOCK_LENGTH];
+static volatile int32_t Sink;
+static uint32_t Random = 1;
+
+//*****************************************************************************
+// Purpose: Host time in ns.
+// Argument: None
+// Return: Monotonic time
+//
+//*****************************************************************************
+
+static uint64_t HostNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+//*****************************************************************************
+// Purpose: Run one kernel over every block NUM_PASSES times.
+// Argument: kernel - Kernel to run
+// Return: None
+//
+//*****************************************************************************
+
+static void RunKernel(Kernel_t kernel)
+{
+    DSP__Cic_t cic;
+    DSP__Iir_t filter;
+    DSP__Stats_t stats;
+    DSP__Threshold_t detector;
+    uint16_t pass;
+    uint16_t block;
+    uint64_t ns;
+    uint64_t cycles;
+
+    DSP__CicInit(&cic, 3, 4);
+    DSP__IirInit(&filter, (kernel == KERNEL_IIR1) ? 1 : 2, 4,
+                 (kernel == KERNEL_HIGHPASS) ? DSP__IIR_HIGHPASS : DSP__IIR_LOWPASS, Input[0][0]);
+    DSP__ThresholdInit(&detector, 600, 400, false);
+
+    ns = HostNs();
+    cycles = HOST_CYCLES();
+
+    for(pass = 0; pass < NUM_PASSES; pass++)
+    {
+        for(block = 0; block < NUM_BLOCKS; block++)
+        {
+            switch(kernel)
+            {
+                case KERNEL_CIC:
+                    Sink += DSP__CicDecimate(&cic, Input[block], BLOCK_LENGTH, Output);
+                    break;
+
+                case KERNEL_IIR1:
+                case KERNEL_IIR2:
+                case KERNEL_HIGHPASS:
+                    DSP__IirFilter(&filter, Input[block], BLOCK_LENGTH, Output);
+                    Sink += Output[BLOCK_LENGTH - 1];
+                    break;
+
+                case KERNEL_STATS:
+                    DSP__StatsReset(&stats);
+                    DSP__StatsUpdate(&stats, Input[block], BLOCK_LENGTH);
+                    Sink += stats.sum;
+                    break;
+
+                default:
+                    Sink += DSP__ThresholdDetect(&detector, Input[block], BLOCK_LENGTH);
+                    break;
+            }
+        }
+    }
+
+    Costs[kernel].cycles = (double)(HOST_CYCLES() - cycles) / NUM_SAMPLES;
+    Costs[kernel].ns = (double)(HostNs() - ns) / NUM_SAMPLES;
+    Costs[kernel].name = KernelNames[kernel];
+}
+
+int main(void)
+{
+    uint16_t block;
+    uint16_t index;
+    uint8_t kernel;
+
+    //ADC10 results, a slow ramp around mid scale with noise
+    for(block = 0; block < NUM_BLOCKS; block++)
+    {
+        for(index = 0; index < BLOCK_LENGTH; index++)
+        {
+            Random = Random*1103515245 + 12345;
+            Input[block][index] = (int16_t)(312 + (((block * BLOCK_LENGTH) + index) / 5) + ((Random >> 16) & 0x3F));
+        }
+    }
+
+    for(kernel = 0; kernel < NUM_KERNELS; kernel++)
+    {
+        RunKernel(kernel);
+    }
+
+    printf("DSP kernels over %u samples in blocks of %u\n", (unsigned)NUM_SAMPLES, BLOCK_LENGTH);
+    printf("%-22s %18s %20s\n", "kernel", "host ns/sample", "host cycles/sample");
+
+    for(kernel = 0; kernel < NUM_KERNELS; kernel++)
+    {
+        printf("%-22s %18.2f %20.1f\n", Costs[kernel].name, Costs[kernel].ns, Costs[kernel].cycles);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+// *****************************************************************************
+// *  File: bench_gpio_handle.c
+// *
+// *  Purpose:
+// *  Cost of a pin access through a GPIO_Pin_t handle against the same access
+// *  by pin ID. Register accesses are counted in simulated MCLK cycles and the
+// *  host time per call is measured over a run of calls. Both forms make one
+// *  register access and most of the host time is the simulated access, the
+// *  difference is the pin ID decode and call the handle avoids. The
+// *  instructions each form compiles to are counted by make asm from
+// *  TESTS/asm_gpio_pin.c.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+#include <time.h>
+
+#define NUM_CALLS                   200000
+#define LED_PIN_ID                  GPIO_IOID5
+#define LED_PIN                     GPIO_PIN(LED_PIN_ID)
+
+typedef struct {
+    const char *name;
+    uint64_t cycles;
+    double ns;
+} Cost_t;
+
+// Private variables defined here
+static Cost_t Costs[4];
+static volatile uint8_t Sink;
+
+//*****************************************************************************
+// Purpose: Host time in ns.
+// Argument: None
+// Return: Monotonic time
+//
+//*****************************************************************************
+
+static uint64_t HostNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, runs each access form NUM_CALLS times.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    uint64_t cycles;
+    uint64_t ns;
+    uint32_t call;
+
+    HW__InitialiseSystem();
+    GPIO_reset();
+    GPIO_configurePin(LED_PIN_ID, SET_AS_OUTPUT);
+
+    Costs[0].name = "GPIO_write(handle)";
+    cycles = HOSTSIM__GetCycles();
+    ns = HostNs();
+    for(call = 0; call < NUM_CALLS; call++)
+    {
+        GPIO_write(LED_PIN, call & 0x01);
+    }
+    Costs[0].ns = (double)(HostNs() - ns) / NUM_CALLS;
+    Costs[0].cycles = HOSTSIM__GetCycles() - cycles;
+
+    Costs[1].name = "GPIO_pinWrite(id)";
+    cycles = HOSTSIM__GetCycles();
+    ns = HostNs();
+    for(call = 0; call < NUM_CALLS; call++)
+    {
+        GPIO_pinWrite(LED_PIN_ID, call & 0x01);
+    }
+    Costs[1].ns = (double)(HostNs() - ns) / NUM_CALLS;
+    Costs[1].cycles = HOSTSIM__GetCycles() - cycles;
+
+    Costs[2].name = "GPIO_read(handle)";
+    cycles = HOSTSIM__GetCycles();
+    ns = HostNs();
+    for(call = 0; call < NUM_CALLS; call++)
+    {
+        Sink = GPIO_read(LED_PIN);
+    }
+    Costs[2].ns = (double)(HostNs() - ns) / NUM_CALLS;
+    Costs[2].cycles = HOSTSIM__GetCycles() - cycles;
+
+    Costs[3].name = "GPIO_pinRead(id)";
+    cycles = HOSTSIM__GetCycles();
+    ns = HostNs();
+    for(call = 0; call < NUM_CALLS; call++)
+    {
+        Sink = GPIO_pinRead(LED_PIN_ID);
+    }
+    Costs[3].ns = (double)(HostNs() - ns) / NUM_CALLS;
+    Costs[3].cycles = HOSTSIM__GetCycles() - cycles;
+}
+
+int main(void)
+{
+    uint8_t cost;
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(Entry, 8 * NUM_CALLS * HOSTSIM__ACCESS_CYCLES);
+
+    printf("P1.5 access by handle and by pin ID over %u calls\n", NUM_CALLS);
+    printf("%-20s %15s %16s\n", "access", "accesses/call", "host ns/call");
+
+    for(cost = 0; cost < sizeof(Costs) / sizeof(Costs[0]); cost++)
+    {
+        printf("%-20s %15.2f %16.1f\n", Costs[cost].name,
+               (double)Costs[cost].cycles / HOSTSIM__ACCESS_CYCLES / NUM_CALLS, Costs[cost].ns);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+// *****************************************************************************
+// *  File: bench_gpio_port.c
+// *
+// *  Purpose:
+// *  Register access cost of driving all 8 pins of P1 one pin ID at a time
+// *  against the whole port calls. Each operation is timed in simulated MCLK
+// *  cycles, only register accesses take time in the simulator so the cycles
+// *  over the access cost give the register accesses made.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define NUM_PINS                    8
+#define PORT_VALUE                  0xA5
+
+typedef struct {
+    const char *name;
+    uint64_t pinCycles;
+    uint64_t portCycles;
+} Cost_t;
+
+// Private variables defined here
+static const GPIO_PortConfig_t PortConfig[] = {
+    {MSP_PORT1, 0xFF, SET_AS_OUTPUT},
+};
+
+static Cost_t Costs[4];
+static uint8_t PinValue;
+static uint8_t PortValue;
+
+//*****************************************************************************
+// Purpose: Simulated program, runs each operation both ways on P1.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    uint64_t start;
+    uint8_t pin;
+
+    HW__InitialiseSystem();
+    GPIO_reset();
+
+    Costs[0].name = "configure 8 outputs";
+    start = HOSTSIM__GetCycles();
+    for(pin = 0; pin < NUM_PINS; pin++)
+    {
+        GPIO_configurePin(GPIO_IOID0 + pin, SET_AS_OUTPUT);
+    }
+    Costs[0].pinCycles = HOSTSIM__GetCycles() - start;
+
+    start = HOSTSIM__GetCycles();
+    GPIO_configurePort(PortConfig, sizeof(PortConfig) / sizeof(PortConfig[0]));
+    Costs[0].portCycles = HOSTSIM__GetCycles() - start;
+
+    Costs[1].name = "write 8 pins";
+    start = HOSTSIM__GetCycles();
+    for(pin = 0; pin < NUM_PINS; pin++)
+    {
+        GPIO_pinWrite(GPIO_IOID0 + pin, ((PORT_VALUE >> pin) & 0x01) ? LOGIC_HIGH : LOGIC_LOW);
+    }
+    Costs[1].pinCycles = HOSTSIM__GetCycles() - start;
+
+    start = HOSTSIM__GetCycles();
+    GPIO_portWrite(MSP_PORT1, 0xFF, PORT_VALUE);
+    Costs[1].portCycles = HOSTSIM__GetCycles() - start;
+
+    Costs[2].name = "set 8 pins";
+    start = HOSTSIM__GetCycles();
+    for(pin = 0; pin < NUM_PINS; pin++)
+    {
+        GPIO_pinWrite(GPIO_IOID0 + pin, LOGIC_HIGH);
+    }
+    Costs[2].pinCycles = HOSTSIM__GetCycles() - start;
+
+    start = HOSTSIM__GetCycles();
+    GPIO_portSet(MSP_PORT1, 0xFF);
+    Costs[2].portCycles = HOSTSIM__GetCycles() - start;
+
+    Costs[3].name = "read 8 pins";
+    PinValue = 0;
+    start = HOSTSIM__GetCycles();
+    for(pin = 0; pin < NUM_PINS; pin++)
+    {
+        if(GPIO_pinRead(GPIO_IOID0 + pin))
+        {
+            PinValue |= 1 << pin;
+        }
+    }
+    Costs[3].pinCycles = HOSTSIM__GetCycles() - start;
+
+    start = HOSTSIM__GetCycles();
+    PortValue = GPIO_portRead(MSP_PORT1);
+    Costs[3].portCycles = HOSTSIM__GetCycles() - start;
+}
+
+int main(void)
+{
+    uint8_t cost;
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__SetPortInput(MSP_PORT1, 0xFF, PORT_VALUE);
+    HOSTSIM__Run(Entry, 100000);
+
+    printf("P1 access cost in MCLK cycles, %u cycles per register access\n", HOSTSIM__ACCESS_CYCLES);
+    printf("%-22s %18s %18s\n", "operation", "per pin ID", "whole port");
+    printf("%-22s %8s %9s %8s %9s\n", "", "cycles", "accesses", "cycles", "accesses");
+
+    for(cost = 0; cost < sizeof(Costs) / sizeof(Costs[0]); cost++)
+    {
+        printf("%-22s %8u %9u %8u %9u\n", Costs[cost].name,
+               (unsigned)Costs[cost].pinCycles, (unsigned)(Costs[cost].pinCycles / HOSTSIM__ACCESS_CYCLES),
+               (unsigned)Costs[cost].portCycles, (unsigned)(Costs[cost].portCycles / HOSTSIM__ACCESS_CYCLES));
+    }
+
+    if(PinValue != PortValue)
+    {
+        printf("pin reads 0x%02X differ from the port read 0x%02X\n", PinValue, PortValue);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
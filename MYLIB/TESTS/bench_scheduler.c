@@ -0,0 +1,223 @@
+// *****************************************************************************
+// *  File: bench_scheduler.c
+// *
+// *  Purpose:
+// *  Dispatch latency of the task scheduler. A rising edge on P1.3 is posted
+// *  to a task from the port interrupt, the time from the edge to the post and
+// *  from the post to the task running is measured over a series of edges,
+// *  with the scheduler asleep and with a soft timer callback doing work in
+// *  the higher priority soft timer task. Run to completion means the edge
+// *  task waits for a running task to return.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define NUM_EDGES                   200
+#define EDGE_INTERVAL_US            2377    //Edges drift against the soft timer ticks
+#define EDGE_WIDTH_US               100
+#define BUSY_CYCLES                 500     //Work done by the soft timer callback each time it runs
+#define BUSY_PERIOD_MS              3
+
+#define EVENT_EDGE                  0x0100
+
+typedef struct {
+    uint32_t count;
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+} Latency_t;
+
+// Private variables defined here
+static uint64_t EdgeNs;
+static uint64_t PostNs;
+static uint32_t Edges;
+static bool Busy;
+static Latency_t ToPost;
+static Latency_t ToRun;
+
+//*****************************************************************************
+// Purpose: Add a measurement to a latency summary.
+// Argument: latency - Latency summary
+//           ns - Measured latency
+// Return: None
+//
+//*****************************************************************************
+
+static void AddLatency(Latency_t *latency, uint64_t ns)
+{
+    if((latency->count == 0) || (ns < latency->min))
+    {
+        latency->min = ns;
+    }
+
+    if(ns > latency->max)
+    {
+        latency->max = ns;
+    }
+
+    latency->total += ns;
+    latency->count++;
+}
+
+//*****************************************************************************
+// Purpose: Stimulus event, raises P1.3 and lowers it again.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Edge(void)
+{
+    static bool high;
+
+    high = !high;
+    HOSTSIM__SetPortInput(MSP_PORT1, MSP_PORT_IO3, high ? MSP_PORT_IO3 : 0);
+
+    if(high)
+    {
+        EdgeNs = HOSTSIM__GetTimeNs();
+        HOSTSIM__ScheduleEvent(EDGE_WIDTH_US, Edge);
+    }
+    else if(++Edges < NUM_EDGES)
+    {
+        HOSTSIM__ScheduleEvent(EDGE_INTERVAL_US - EDGE_WIDTH_US, Edge);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Pin callback, called from the port interrupt, posts the edge task.
+// Argument: gpio_pin_id - Pin with the edge
+// Return: None
+//
+//*****************************************************************************
+
+static void PinCallback(uint8_t gpio_pin_id)
+{
+    (void)gpio_pin_id;
+
+    PostNs = HOSTSIM__GetTimeNs();
+    SCHED__Post(SCHED__APPLICATION_TASK, EVENT_EDGE);
+}
+
+//*****************************************************************************
+// Purpose: Edge task, records the latencies of the edge.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void EdgeTask(uint16_t events)
+{
+    if(events & EVENT_EDGE)
+    {
+        AddLatency(&ToPost, PostNs - EdgeNs);
+        AddLatency(&ToRun, HOSTSIM__GetTimeNs() - PostNs);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Soft timer callback, run by the soft timer task ahead of the
+//          application task.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void BusyTimer(void)
+{
+    uint16_t cycles;
+
+    //Interrupts are taken between the delays, as they would during the work
+    for(cycles = 0; cycles < BUSY_CYCLES; cycles += 10)
+    {
+        HOSTSIM__Delay(10);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Scheduler task running the expired soft timer callbacks.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void SoftTimerTask(uint16_t events)
+{
+    (void)events;
+    SOFTTMR__ProcessCallbacks();
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, takes the edges on P1.3 through the scheduler.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    SOFTTMR__Reset();
+    UPTIME__Reset();
+    GPIO_reset();
+
+    GPIO_configurePin(GPIO_IOID3, SET_AS_INPUT);
+    GPIO_registerCallback(GPIO_IOID3, PinCallback);
+    INT__Enable(IO_INT_3);
+
+    SCHED__Init();
+    SCHED__RegisterTask(SCHED__SOFTTMR_TASK, SoftTimerTask);
+    SCHED__RegisterTask(SCHED__APPLICATION_TASK, EdgeTask);
+
+    if(Busy)
+    {
+        SOFTTMR__RegisterCallback(SOFTTMR__RES_1MS, LED_SOFT_TIMER_2, BusyTimer, BUSY_PERIOD_MS, SOFTTMR__AUTO_RELOAD);
+    }
+
+    HOSTSIM__ScheduleEvent(EDGE_INTERVAL_US, Edge);
+    SCHED__Run();
+}
+
+//*****************************************************************************
+// Purpose: Run the edges and print the latencies.
+// Argument: name - Load description
+//           busy - True to run the soft timer callback
+// Return: None
+//
+//*****************************************************************************
+
+static void RunEdges(const char *name, bool busy)
+{
+    Busy = busy;
+    Edges = 0;
+    ToPost = (Latency_t){0};
+    ToRun = (Latency_t){0};
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(Entry, (NUM_EDGES + 5) * EDGE_INTERVAL_US);
+
+    printf("%-28s %5u  %6.1f %6.1f %6.1f  %6.1f %6.1f %6.1f\n", name, (unsigned)ToRun.count,
+           ToPost.min / 1e3, (double)ToPost.total / ToPost.count / 1e3, ToPost.max / 1e3,
+           ToRun.min / 1e3, (double)ToRun.total / ToRun.count / 1e3, ToRun.max / 1e3);
+}
+
+int main(void)
+{
+    printf("Edge to task latency in us at 1MHz MCLK\n");
+    printf("%-28s %5s  %20s  %20s\n", "load", "edges", "edge to post", "post to run");
+    printf("%-28s %5s  %6s %6s %6s  %6s %6s %6s\n", "", "", "min", "mean", "max", "min", "mean", "max");
+
+    RunEdges("idle, asleep in LPM", false);
+    RunEdges("500 cycle callback every 3ms", true);
+
+    return EXIT_SUCCESS;
+}
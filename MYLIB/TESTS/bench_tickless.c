@@ -0,0 +1,164 @@
+// *****************************************************************************
+// *  File: bench_tickless.c
+// *
+// *  Purpose:
+// *  Timer A wake ups of the periodic and tickless soft timer modes for some
+// *  typical timer mixes over 10s of simulated time. Both modes must run the
+// *  same callbacks, the tickless mode only wakes for the timer deadlines and
+// *  the Timer A overflow counted by the uptime clock.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define RUN_US                      10000000
+#define MAX_MIX_TIMERS              3
+
+typedef struct {
+    uint8_t resolution;
+    uint8_t timerId;
+    uint16_t period;
+} Timer_t;
+
+typedef struct {
+    const char *name;
+    uint8_t numTimers;
+    Timer_t timers[MAX_MIX_TIMERS];
+} Mix_t;
+
+// Private variables defined here
+static const Mix_t Mixes[] = {
+    {"1s heartbeat", 1, {{SOFTTMR__RES_1MS, LED_SOFT_TIMER_2, 1000}}},
+    {"500ms led, 10ms poll", 2, {{SOFTTMR__RES_10MS, LED_SOFT_TIMER, 50}, {SOFTTMR__RES_10MS, DEBOUNCE_SOFT_TIMER, 1}}},
+    {"1s watchdog, 60s cal", 2, {{SOFTTMR__RES_100MS, WATCHDOG_SOFT_TIMER, 10}, {SOFTTMR__RES_1S, DCOCAL_SOFT_TIMER, 60}}},
+    {"50ms sample, 1s, 60s", 3, {{SOFTTMR__RES_1MS, LED_SOFT_TIMER_2, 50}, {SOFTTMR__RES_100MS, WATCHDOG_SOFT_TIMER, 10}, {SOFTTMR__RES_1S, DCOCAL_SOFT_TIMER, 60}}},
+};
+
+static const Mix_t *Mix;
+static uint16_t TickMode;
+static uint32_t Callbacks;
+
+//*****************************************************************************
+// Purpose: Soft timer callback, counts the callbacks run.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Callback(void)
+{
+    Callbacks++;
+}
+
+//*****************************************************************************
+// Purpose: Scheduler task running the expired soft timer callbacks.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void SoftTimerTask(uint16_t events)
+{
+    (void)events;
+    SOFTTMR__ProcessCallbacks();
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, runs the timer mix in the selected tick mode.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    uint16_t control[SOFTTMR__CONFIG_BUFFER_SIZE];
+    uint8_t index;
+
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    SOFTTMR__Reset();
+    UPTIME__Reset();
+
+    control[SOFTTMR__CONFIG_SETTING_IDX] = TickMode;
+    SOFTTMR__Control(control);
+
+    for(index = 0; index < Mix->numTimers; index++)
+    {
+        SOFTTMR__RegisterCallback(Mix->timers[index].resolution, Mix->timers[index].timerId, Callback, Mix->timers[index].period, SOFTTMR__AUTO_RELOAD);
+    }
+
+    SCHED__Init();
+    SCHED__RegisterTask(SCHED__SOFTTMR_TASK, SoftTimerTask);
+
+    HOSTSIM__ClearVectorStats();
+    SCHED__Run();
+}
+
+//*****************************************************************************
+// Purpose: Run a timer mix in one tick mode.
+// Argument: mix - Timer mix
+//           tickMode - SOFTTMR__TICK_MODE_PERIODIC or SOFTTMR__TICK_MODE_TICKLESS
+//           compare - Timer A CC0 interrupts per second
+//           overflow - Timer A CC1 and overflow interrupts per second
+// Return: Callbacks run
+//
+//*****************************************************************************
+
+static uint32_t RunMix(const Mix_t *mix, uint16_t tickMode, double *compare, double *overflow)
+{
+    HOSTSIM__VectorStats_t stats;
+
+    Mix = mix;
+    TickMode = tickMode;
+    Callbacks = 0;
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(Entry, RUN_US);
+
+    HOSTSIM__GetVectorStats(TIMERA0_VECTOR, &stats);
+    *compare = stats.count / (RUN_US / 1e6);
+    HOSTSIM__GetVectorStats(TIMERA1_VECTOR, &stats);
+    *overflow = stats.count / (RUN_US / 1e6);
+
+    return Callbacks;
+}
+
+int main(void)
+{
+    uint32_t periodicCallbacks;
+    uint32_t ticklessCallbacks;
+    double periodicCompare;
+    double periodicOverflow;
+    double ticklessCompare;
+    double ticklessOverflow;
+    uint8_t mix;
+    int status = EXIT_SUCCESS;
+
+    printf("Timer A wake ups per second over %.0fs, compare + overflow\n", RUN_US / 1e6);
+    printf("%-24s %18s %18s %10s\n", "mix", "periodic", "tickless", "callbacks");
+
+    for(mix = 0; mix < sizeof(Mixes) / sizeof(Mixes[0]); mix++)
+    {
+        periodicCallbacks = RunMix(&Mixes[mix], SOFTTMR__TICK_MODE_PERIODIC, &periodicCompare, &periodicOverflow);
+        ticklessCallbacks = RunMix(&Mixes[mix], SOFTTMR__TICK_MODE_TICKLESS, &ticklessCompare, &ticklessOverflow);
+
+        printf("%-24s %8.1f + %7.1f %8.1f + %7.1f %4u/%-5u\n", Mixes[mix].name, periodicCompare, periodicOverflow, ticklessCompare, ticklessOverflow,
+               (unsigned)periodicCallbacks, (unsigned)ticklessCallbacks);
+
+        if(periodicCallbacks != ticklessCallbacks)
+        {
+            printf("%s: callbacks differ between the tick modes\n", Mixes[mix].name);
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,198 @@
+// *****************************************************************************
+// *  File: bench_timerwheel.c
+// *
+// *  Purpose:
+// *  Tick work of the timer wheel against the decrement loop it replaced, for
+// *  16, 64 and 255 running timers with periods of 1 to 2000 ticks restarted
+// *  on expiry. The work is counted as the timer entries a tick touches, the
+// *  decrement loop touches every timer, the wheel only the timers expiring
+// *  or cascaded on the tick. Host time per tick is reported alongside.
+// *
+// *  The wheel indexes timers with a byte, 255 timers is its limit.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+#include <string.h>
+#include <time.h>
+
+#define MAX_TIMERS                  TWHEEL__MAX_TIMERS
+#define MAX_PERIOD                  2000
+#define NUM_TICKS                   60000
+#define WHEEL_LEVELS                SOFTTMR__WHEEL_LEVELS_1MS
+
+// Private variables defined here
+static TWHEEL__Wheel_t Wheel;
+static TWHEEL__Timer_t Timers[MAX_TIMERS];
+static TWHEEL__Timer_t Before[MAX_TIMERS];
+static uint8_t Buckets[TWHEEL__NUM_BUCKETS(WHEEL_LEVELS)];
+static uint16_t Period[MAX_TIMERS];
+static uint16_t Counter[MAX_TIMERS];
+static uint32_t Expiries;
+static uint32_t Random = 1;
+
+//*****************************************************************************
+// Purpose: Pseudo random numbers, the same sequence on every host.
+// Argument: None
+// Return: Random number, 0 to 32767
+//
+//*****************************************************************************
+
+static uint16_t NextRandom(void)
+{
+    Random = (Random * 1103515245) + 12345;
+
+    return (Random >> 16) & 0x7FFF;
+}
+
+//*****************************************************************************
+// Purpose: Host time in ns.
+// Argument: None
+// Return: Monotonic time
+//
+//*****************************************************************************
+
+static uint64_t HostNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+//*****************************************************************************
+// Purpose: Wheel expiry handler, restarts the timer for its period.
+// Argument: wheel - Timer wheel
+//           timerId - Expired timer
+// Return: None
+//
+//*****************************************************************************
+
+static void Expired(TWHEEL__Wheel_t *wheel, uint8_t timerId)
+{
+    Expiries++;
+    TWHEEL__Start(wheel, timerId, Period[timerId]);
+}
+
+//*****************************************************************************
+// Purpose: Run the wheel, counting the timers each tick moves or expires.
+// Argument: numTimers - Running timers
+//           touched - Timer entries touched over all ticks
+// Return: Host ns per tick, measured in a separate run
+//
+//*****************************************************************************
+
+static double RunWheel(uint8_t numTimers, uint32_t *touched)
+{
+    uint32_t tick;
+    uint16_t index;
+    uint64_t start;
+
+    TWHEEL__Init(&Wheel, Timers, numTimers, Buckets, WHEEL_LEVELS, Expired);
+
+    for(index = 0; index < numTimers; index++)
+    {
+        TWHEEL__Start(&Wheel, index, Period[index]);
+    }
+
+    *touched = 0;
+    Expiries = 0;
+
+    for(tick = 0; tick < NUM_TICKS; tick++)
+    {
+        memcpy(Before, Timers, numTimers * sizeof(TWHEEL__Timer_t));
+        TWHEEL__Tick(&Wheel);
+
+        for(index = 0; index < numTimers; index++)
+        {
+            if(memcmp(&Before[index], &Timers[index], sizeof(TWHEEL__Timer_t)) != 0)
+            {
+                (*touched)++;
+            }
+        }
+    }
+
+    start = HostNs();
+
+    for(tick = 0; tick < NUM_TICKS; tick++)
+    {
+        TWHEEL__Tick(&Wheel);
+    }
+
+    return (double)(HostNs() - start) / NUM_TICKS;
+}
+
+//*****************************************************************************
+// Purpose: Run the decrement loop the wheel replaced.
+// Argument: numTimers - Running timers
+// Return: Host ns per tick
+//
+//*****************************************************************************
+
+static double RunDecrement(uint16_t numTimers)
+{
+    uint32_t tick;
+    uint16_t index;
+    uint64_t start;
+
+    for(index = 0; index < numTimers; index++)
+    {
+        Counter[index] = Period[index];
+    }
+
+    start = HostNs();
+
+    for(tick = 0; tick < NUM_TICKS; tick++)
+    {
+        for(index = 0; index < numTimers; index++)
+        {
+            if(Counter[index] > 0)
+            {
+                Counter[index]--;
+            }
+
+            //Restarted by the application on reading zero
+            if(Counter[index] == 0)
+            {
+                Counter[index] = Period[index];
+            }
+        }
+    }
+
+    return (double)(HostNs() - start) / NUM_TICKS;
+}
+
+int main(void)
+{
+    static const uint8_t sizes[] = {16, 64, MAX_TIMERS};
+    uint32_t touched;
+    uint16_t index;
+    uint8_t size;
+    double wheelNs;
+    double loopNs;
+
+    for(index = 0; index < MAX_TIMERS; index++)
+    {
+        Period[index] = 1 + (NextRandom() % MAX_PERIOD);
+    }
+
+    printf("%u ticks, periods 1 to %u ticks, %u wheel levels\n", NUM_TICKS, MAX_PERIOD, WHEEL_LEVELS);
+    printf("timers  expiries/tick  touched/tick wheel  loop  host ns/tick wheel  loop\n");
+
+    for(size = 0; size < sizeof(sizes); size++)
+    {
+        wheelNs = RunWheel(sizes[size], &touched);
+        loopNs = RunDecrement(sizes[size]);
+
+        printf("%6u  %13.2f  %18.2f  %4u  %18.1f  %4.1f\n", sizes[size], (double)Expiries / NUM_TICKS, (double)touched / NUM_TICKS, sizes[size], wheelNs, loopNs);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,51 @@
+// *****************************************************************************
+// *  File: hosttest.h
+// *
+// *  Purpose:
+// *  Check helpers shared by the host test programs. A failed check is
+// *  reported with its location and the test carries on, the program exit
+// *  status reports whether any check failed.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef _HOSTTEST_H_
+#define _HOSTTEST_H_
+
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static int TEST__Failures;
+
+//Check a condition, printing the condition when it does not hold
+#define TEST__CHECK(condition) \
+    do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); TEST__Failures++; } } while(0)
+
+//Check an integer value lies within a range, printing the value when it does not
+#define TEST__CHECK_RANGE(value, low, high) \
+    do { long long v_ = (long long)(value); \
+         if((v_ < (long long)(low)) || (v_ > (long long)(high))) { \
+             printf("%s:%d: check failed: %s = %lld, expected %lld to %lld\n", __FILE__, __LINE__, #value, v_, (long long)(low), (long long)(high)); \
+             TEST__Failures++; } } while(0)
+
+//*****************************************************************************
+// Purpose: Report the result of a test program, to be returned from main.
+// Argument: name - Test name
+// Return: Program exit status, non zero if any check failed
+//
+//*****************************************************************************
+
+static inline int TEST__Result(const char *name)
+{
+    printf("%s: %s\n", name, (TEST__Failures == 0) ? "PASS" : "FAIL");
+
+    return (TEST__Failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif //_HOSTTEST_H_
@@ -0,0 +1,230 @@
+// *****************************************************************************
+// *  File: test_adc_oversample.c
+// *
+// *  Purpose:
+// *  Checks of the oversampled ADC10 streams: a slowly moving input with
+// *  under one count of noise is resolved to the extra bits the noise allows,
+// *  the results come at the sample rate over 4^n, and invalid oversampling is
+// *  refused. The resolution is reported as effective bits from the rms error
+// *  against the mean input over each result.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+#include <math.h>
+
+#define MAX_BLOCK                   ADC__MAX_OVERSAMPLE_BLOCK
+#define INPUT_STEP_US               5       //Input updated every step
+#define RUN_US                      500000
+#define SETTLE_RESULTS              2       //Results skipped before the error is measured
+
+// Private variables defined here
+static uint16_t Buffer[2 * MAX_BLOCK];
+static uint8_t ExtraBits;
+static double Amplitude;            //Input sine wave amplitude, counts
+static double Noise;                //Input noise, rms counts
+static double InputSum;             //Input since the last result
+static uint32_t InputSteps;
+static uint32_t Results;
+static double ErrorSquares;
+static uint32_t Random;
+static uint16_t OversampleHz;
+static uint8_t OversampleBlock;
+static bool Started;
+static bool StartRefused;
+
+//*****************************************************************************
+// Purpose: Pseudo random numbers, the same sequence on every host.
+// Argument: None
+// Return: Random number, above 0 and below 1
+//
+//*****************************************************************************
+
+static double NextRandom(void)
+{
+    Random = (Random * 1103515245) + 12345;
+
+    return (((Random >> 8) & 0xFFFFFF) + 0.5) / 16777216.0;
+}
+
+//*****************************************************************************
+// Purpose: Stimulus event, a 0.5Hz sine wave about 300.3 counts with
+//          gaussian noise, quantised to the ADC10 range.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Input(void)
+{
+    double level = 300.3 + (Amplitude * sin(M_PI * HOSTSIM__GetTimeNs() / 1e9));
+    double noise = sqrt(-2.0 * log(NextRandom())) * cos(2.0 * M_PI * NextRandom());
+    long count = lround(level + (Noise * noise));
+
+    InputSum += level;
+    InputSteps++;
+
+    HOSTSIM__SetAnalogInput(0, (uint16_t)((count < 0) ? 0 : ((count > 1023) ? 1023 : count)));
+    HOSTSIM__ScheduleEvent(INPUT_STEP_US, Input);
+}
+
+//*****************************************************************************
+// Purpose: Result callback, accumulates the error against the mean input.
+// Argument: result - Oversampled result
+// Return: None
+//
+//*****************************************************************************
+
+static void Result(uint16_t result)
+{
+    double error = (result / (double)(1 << ExtraBits)) - (InputSum / InputSteps);
+
+    if(Results++ >= SETTLE_RESULTS)
+    {
+        ErrorSquares += error * error;
+    }
+
+    InputSum = 0;
+    InputSteps = 0;
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, oversamples the input until the run time limit.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StreamEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    Started = ADC__StartOversampled(0, ExtraBits, OversampleHz, Buffer, OversampleBlock, Result);
+    HOSTSIM__ScheduleEvent(INPUT_STEP_US, Input);
+
+    for(;;)
+    {
+        _disable_interrupts();
+        HW__EnterLowpower();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, checks invalid oversampling is refused.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void ControlEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    StartRefused = !ADC__StartOversampled(0, 0, 0, Buffer, 1, Result) && !ADC__StartOversampled(0, ADC__MAX_OVERSAMPLE_BITS + 1, 0, Buffer, 16, Result);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__INVALID_OVERSAMPLING));
+
+    //Blocks must be a power of 2 and no more than the samples of a result
+    StartRefused = StartRefused && !ADC__StartOversampled(0, 2, 0, Buffer, 12, Result) && !ADC__StartOversampled(0, 1, 0, Buffer, 8, Result);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__INVALID_BLOCK_SIZE));
+    TEST__CHECK(!ADC__IsRunning());
+}
+
+//*****************************************************************************
+// Purpose: Run an oversampled stream and report its effective resolution.
+// Argument: extraBits - Extra result bits
+//           sampleHz - Conversions per second, 0 to convert back to back
+//           blockSize - Conversions per block
+//           amplitude - Input sine wave amplitude, counts
+//           noise - Input noise, rms counts
+// Return: Effective number of bits
+//
+//*****************************************************************************
+
+static double RunOversampled(uint8_t extraBits, uint16_t sampleHz, uint8_t blockSize, double amplitude, double noise)
+{
+    double rms;
+    double bits;
+
+    ExtraBits = extraBits;
+    OversampleHz = sampleHz;
+    OversampleBlock = blockSize;
+    Amplitude = amplitude;
+    Noise = noise;
+    InputSum = 0;
+    InputSteps = 0;
+    Results = 0;
+    ErrorSquares = 0;
+    Random = 1;
+    Started = false;
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(StreamEntry, RUN_US);
+
+    TEST__CHECK(Started);
+    TEST__CHECK(ADC__GetOverruns() == 0);
+    TEST__CHECK(ADC__GetMissedSamples() == 0);
+
+    //Effective bits of a 10 bit converter with the rms error of an ideal one
+    rms = sqrt(ErrorSquares / (Results - SETTLE_RESULTS));
+    bits = 10.0 - log2(rms * sqrt(12.0));
+
+    printf("%u extra bits, %u Hz, blocks of %u, amplitude %.0f, noise %.1f: %u results, %.2f effective bits\n", extraBits, sampleHz, blockSize, amplitude, noise, (unsigned)Results, bits);
+
+    return bits;
+}
+
+//*****************************************************************************
+// Purpose: Effective bits expected from averaging 4^n conversions of an
+//          input with noise, the noise and the 10 bit quantisation error fall
+//          by 2^n.
+// Argument: extraBits - Extra result bits
+//           noise - Input noise, rms counts
+// Return: Effective number of bits
+//
+//*****************************************************************************
+
+static double ExpectedBits(uint8_t extraBits, double noise)
+{
+    double rms = sqrt((noise * noise) + (1.0 / 12.0)) / (1 << extraBits);
+
+    return 10.0 - log2(rms * sqrt(12.0));
+}
+
+int main(void)
+{
+    double bits;
+
+    //Free running, about 43ksps over 256 conversions per result
+    bits = RunOversampled(4, 0, 16, 200.0, 0.7);
+    TEST__CHECK(bits >= ExpectedBits(4, 0.7) - 0.5);
+    TEST__CHECK(bits >= 12.0);
+    TEST__CHECK_RANGE(Results, (RUN_US / 1e6) * 38000 / 256, (RUN_US / 1e6) * 48000 / 256);
+
+    //Paced by Timer A with whole blocks of 4 conversions per result
+    bits = RunOversampled(1, 20000, 4, 200.0, 0.7);
+    TEST__CHECK(bits >= ExpectedBits(1, 0.7) - 0.5);
+    TEST__CHECK_RANGE(Results, (RUN_US / 1e6) * 20000 / 4 * 0.9, (RUN_US / 1e6) * 20000 / 4);
+
+    //A steady input without noise gives the same count for every conversion
+    //of a result, the extra bits add nothing
+    bits = RunOversampled(4, 0, 64, 0.0, 0.0);
+    TEST__CHECK(bits < 10.5);
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(ControlEntry, 100000);
+    TEST__CHECK(StartRefused);
+
+    return TEST__Result("adc_oversample");
+}
@@ -0,0 +1,208 @@
+// *****************************************************************************
+// *  File: test_adc_stream.c
+// *
+// *  Purpose:
+// *  Checks of the double buffered ADC10 streams: channel sequences are
+// *  delivered in whole interleaved blocks at the free running rate, a block
+// *  handler which runs too long is counted as an overrun without breaking
+// *  the channel order, and invalid streams are refused.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define BLOCK_SIZE                  16
+#define SEQUENCE_CHANNELS           4
+#define RUN_US                      200000
+
+// Private variables defined here
+static uint16_t Buffer[2 * BLOCK_SIZE];
+static uint32_t Blocks;
+static uint32_t Samples;
+static uint32_t OutOfOrder;
+static uint32_t ShortBlocks;
+static uint64_t FirstBlockNs;
+static uint64_t LastBlockNs;
+static int8_t ExpectedChannel;
+static uint32_t SlowBlock;          //Block whose handler is held up, 0 for none
+static uint64_t SlowNs;
+static uint16_t Overruns;
+static bool StartRefused;
+static uint8_t StopState;
+
+//*****************************************************************************
+// Purpose: Block callback, checks every result comes from the next channel
+//          of the sequence. Each input is set to 100 times its channel.
+// Argument: block - Conversion results
+//           length - Number of results in the block
+// Return: None
+//
+//*****************************************************************************
+
+static void Block(const uint16_t *block, uint8_t length)
+{
+    uint8_t index;
+    int8_t channel;
+
+    LastBlockNs = HOSTSIM__GetTimeNs();
+    Overruns = ADC__GetOverruns();
+
+    if(Blocks == 0)
+    {
+        FirstBlockNs = LastBlockNs;
+    }
+
+    Blocks++;
+
+    if(length != BLOCK_SIZE)
+    {
+        ShortBlocks++;
+    }
+
+    for(index = 0; index < length; index++)
+    {
+        channel = (int8_t)(block[index] / 100);
+
+        if(ExpectedChannel < 0)
+        {
+            ExpectedChannel = channel;
+        }
+
+        if(channel != ExpectedChannel)
+        {
+            OutOfOrder++;
+        }
+
+        ExpectedChannel = (channel > 0) ? (channel - 1) : (SEQUENCE_CHANNELS - 1);
+        Samples++;
+    }
+
+    if(Blocks == SlowBlock)
+    {
+        while((HOSTSIM__GetTimeNs() - LastBlockNs) < SlowNs)
+        {
+            HOSTSIM__Delay(10);
+        }
+    }
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, streams the channel sequence until the run
+//          time limit.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StreamEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    TEST__CHECK(ADC__StartStream(SEQUENCE_CHANNELS - 1, true, Buffer, BLOCK_SIZE, Block));
+
+    for(;;)
+    {
+        _disable_interrupts();
+        HW__EnterLowpower();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, checks invalid streams are refused and a
+//          stream can be stopped.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void ControlEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    StartRefused = !ADC__StartStream(0, false, Buffer, 0, Block) && !ADC__StartStream(ADC10_MAX_CHANNEL + 1, false, Buffer, BLOCK_SIZE, Block);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__INVALID_BLOCK_SIZE));
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__INVALID_CHANNEL));
+
+    TEST__CHECK(ADC__StartStream(0, false, Buffer, BLOCK_SIZE, Block));
+    HOSTSIM__Delay(2000);
+    ADC__Stop();
+    StopState = ADC__IsRunning() ? 1 : 2;
+}
+
+//*****************************************************************************
+// Purpose: Run a stream with one block handler held up for a time.
+// Argument: slowBlock - Block to hold up, 0 for none
+//           slowNs - Time the block handler is held up for in ns
+// Return: None
+//
+//*****************************************************************************
+
+static void RunStream(uint32_t slowBlock, uint64_t slowNs)
+{
+    uint8_t channel;
+
+    Blocks = 0;
+    Samples = 0;
+    OutOfOrder = 0;
+    ShortBlocks = 0;
+    ExpectedChannel = -1;
+    SlowBlock = slowBlock;
+    SlowNs = slowNs;
+    Overruns = 0;
+
+    HOSTSIM__PowerOn();
+
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+
+    for(channel = 0; channel < SEQUENCE_CHANNELS; channel++)
+    {
+        HOSTSIM__SetAnalogInput(channel, (100 * channel) + 50);
+    }
+
+    HOSTSIM__Run(StreamEntry, RUN_US);
+}
+
+int main(void)
+{
+    double seconds;
+    double rate;
+
+    //Free running, 5MHz / 4 over 16 + 13 clocks is about 43ksps
+    RunStream(0, 0);
+    seconds = (LastBlockNs - FirstBlockNs) / 1e9;
+    rate = ((Blocks - 1) * BLOCK_SIZE) / seconds;
+    printf("stream: %u blocks, %.0f samples/s\n", (unsigned)Blocks, rate);
+    TEST__CHECK_RANGE(rate, 38000, 48000);
+    TEST__CHECK_RANGE(Blocks, (RUN_US / 1e6) * 38000 / BLOCK_SIZE, (RUN_US / 1e6) * 48000 / BLOCK_SIZE);
+    TEST__CHECK(OutOfOrder == 0);
+    TEST__CHECK(ShortBlocks == 0);
+    TEST__CHECK(Overruns == 0);
+
+    //A handler held up for two and a half block periods misses the interrupt
+    //of the next block, seen from the block flag, and keeps the channel order
+    //of the blocks delivered after it
+    RunStream(100, (uint64_t)((2.5 * BLOCK_SIZE * 1e9) / rate));
+    printf("slow handler: %u blocks, %u overruns\n", (unsigned)Blocks, (unsigned)Overruns);
+    TEST__CHECK(Overruns >= 1);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__BLOCK_OVERRUN));
+    TEST__CHECK(OutOfOrder == 0);
+    TEST__CHECK(ShortBlocks == 0);
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(ControlEntry, 100000);
+    TEST__CHECK(StartRefused);
+    TEST__CHECK(StopState == 2);
+
+    return TEST__Result("adc_stream");
+}
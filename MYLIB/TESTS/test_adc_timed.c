@@ -0,0 +1,227 @@
+// *****************************************************************************
+// *  File: test_adc_timed.c
+// *
+// *  Purpose:
+// *  Checks of the Timer A paced ADC10 streams: conversions of a ramp input
+// *  are spaced by exactly one sample period, sample clock edges lost while
+// *  interrupts are held off are counted as missed samples and the clock
+// *  carries on from the current count, the slowest rate runs from either
+// *  Timer A clock, and rates out of range are refused.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define BLOCK_SIZE                  16
+#define SAMPLE_HZ                   5000
+#define RAMP_STEP_US                2       //Input rises by one count every step
+#define RAMP_PERIOD                 ((1000000 / SAMPLE_HZ) / RAMP_STEP_US)
+#define RUN_US                      200000
+#define SLOW_RUN_US                 2000000 //Run of the slowest rate, many whole blocks
+#define SETTLE_SAMPLES              4       //Samples skipped before intervals are checked
+
+// Private variables defined here
+static uint16_t Buffer[2 * BLOCK_SIZE];
+static uint32_t Blocks;
+static uint32_t Samples;
+static int32_t Previous;
+static uint16_t MinInterval;
+static uint16_t MaxInterval;
+static uint32_t Gaps;               //Intervals longer than one sample period
+static uint32_t SlowBlock;          //Block whose handler is held up, 0 for none
+static uint64_t SlowNs;
+static uint16_t Missed;
+static uint16_t SampleHz;
+static bool StartRefused;
+
+//*****************************************************************************
+// Purpose: Stimulus event, moves the ramp input on by one count.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Ramp(void)
+{
+    HOSTSIM__SetAnalogInput(0, (uint16_t)(HOSTSIM__GetTimeNs() / (1000 * RAMP_STEP_US)) & 0x03FF);
+    HOSTSIM__ScheduleEvent(RAMP_STEP_US, Ramp);
+}
+
+//*****************************************************************************
+// Purpose: Block callback, records the ramp steps between conversions.
+// Argument: block - Conversion results
+//           length - Number of results in the block
+// Return: None
+//
+//*****************************************************************************
+
+static void Block(const uint16_t *block, uint8_t length)
+{
+    uint64_t start = HOSTSIM__GetTimeNs();
+    uint16_t interval;
+    uint8_t index;
+
+    Blocks++;
+
+    for(index = 0; index < length; index++)
+    {
+        if((Previous >= 0) && (Samples > SETTLE_SAMPLES))
+        {
+            interval = (block[index] - Previous) & 0x03FF;
+
+            if(interval < MinInterval)
+            {
+                MinInterval = interval;
+            }
+
+            if(interval > MaxInterval)
+            {
+                MaxInterval = interval;
+            }
+
+            if(interval > RAMP_PERIOD + 1)
+            {
+                Gaps++;
+            }
+        }
+
+        Previous = block[index];
+        Samples++;
+    }
+
+    //Interrupts stay disabled in the handler, holding up the sample clock
+    if(Blocks == SlowBlock)
+    {
+        while((HOSTSIM__GetTimeNs() - start) < SlowNs)
+        {
+            HOSTSIM__Delay(10);
+        }
+    }
+
+    Missed = ADC__GetMissedSamples();
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, streams the ramp until the run time limit.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void StreamEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    TEST__CHECK(ADC__StartTimedStream(0, false, SampleHz, Buffer, BLOCK_SIZE, Block));
+    HOSTSIM__ScheduleEvent(RAMP_STEP_US, Ramp);
+
+    for(;;)
+    {
+        _disable_interrupts();
+        HW__EnterLowpower();
+    }
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, checks invalid sample rates are refused.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void ControlEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    ADC__Reset();
+
+    StartRefused = !ADC__StartTimedStream(0, false, 0, Buffer, BLOCK_SIZE, Block) && !ADC__StartTimedStream(0, false, ADC__MAX_SAMPLE_HZ + 1, Buffer, BLOCK_SIZE, Block);
+
+    //Periods that would not fit the timer at the fastest Timer A clock
+    StartRefused = StartRefused && !ADC__StartTimedStream(0, false, 10, Buffer, BLOCK_SIZE, Block) && !ADC__StartTimedStream(0, false, ADC__MIN_SAMPLE_HZ - 1, Buffer, BLOCK_SIZE, Block);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(ADC__INVALID_SAMPLE_RATE));
+    TEST__CHECK(!ADC__IsRunning());
+}
+
+//*****************************************************************************
+// Purpose: Run a timed stream with one block handler held up for a time.
+// Argument: sampleHz - Conversions per second
+//           crystal - True to run Timer A from ACLK, false from SMCLK
+//           runUs - Simulated run time
+//           slowBlock - Block to hold up, 0 for none
+//           slowNs - Time the block handler is held up for in ns
+// Return: None
+//
+//*****************************************************************************
+
+static void RunStream(uint16_t sampleHz, bool crystal, uint32_t runUs, uint32_t slowBlock, uint64_t slowNs)
+{
+    Blocks = 0;
+    Samples = 0;
+    Previous = -1;
+    MinInterval = 0xFFFF;
+    MaxInterval = 0;
+    Gaps = 0;
+    SlowBlock = slowBlock;
+    SlowNs = slowNs;
+    Missed = 0;
+    SampleHz = sampleHz;
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(crystal, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(StreamEntry, runUs);
+}
+
+int main(void)
+{
+    //Every conversion one sample period after the last, the ramp step and
+    //the timer count round the interval by a count either way
+    RunStream(SAMPLE_HZ, true, RUN_US, 0, 0);
+    printf("timed: %u samples, interval %u to %u steps, %u missed\n", (unsigned)Samples, MinInterval, MaxInterval, Missed);
+    TEST__CHECK_RANGE(Samples, (RUN_US / 1e6) * SAMPLE_HZ * 0.9, (RUN_US / 1e6) * SAMPLE_HZ);
+    TEST__CHECK_RANGE(MinInterval, RAMP_PERIOD - 1, RAMP_PERIOD + 1);
+    TEST__CHECK_RANGE(MaxInterval, RAMP_PERIOD - 1, RAMP_PERIOD + 1);
+    TEST__CHECK(Missed == 0);
+
+    //Holding interrupts off for three and a half periods, the first edge
+    //still triggers a conversion, the edges passed before the sample clock is
+    //moved on are counted as missed and the clock restarts one period after
+    //the handler. One gap appears in the ramp.
+    RunStream(SAMPLE_HZ, true, RUN_US, 10, (7 * 1000000000ULL) / (2 * SAMPLE_HZ));
+    printf("held off: %u samples, interval %u to %u steps, %u gaps, %u missed\n", (unsigned)Samples, MinInterval, MaxInterval, (unsigned)Gaps, Missed);
+    TEST__CHECK_RANGE(Missed, 2, 3);
+    TEST__CHECK(Gaps == 1);
+    TEST__CHECK_RANGE(MaxInterval, RAMP_PERIOD * (Missed + 1), RAMP_PERIOD * (Missed + 2) + 1);
+    TEST__CHECK_RANGE(MinInterval, RAMP_PERIOD - 1, RAMP_PERIOD + 1);
+
+    //The slowest rate from ACLK and from the 1MHz SMCLK without a crystal
+    RunStream(ADC__MIN_SAMPLE_HZ, true, SLOW_RUN_US, 0, 0);
+    printf("slowest, ACLK: %u samples, %u missed\n", (unsigned)Samples, Missed);
+    TEST__CHECK_RANGE(Samples, (SLOW_RUN_US / 1e6) * ADC__MIN_SAMPLE_HZ * 0.9, (SLOW_RUN_US / 1e6) * ADC__MIN_SAMPLE_HZ + 1);
+    TEST__CHECK(Missed == 0);
+
+    RunStream(ADC__MIN_SAMPLE_HZ, false, SLOW_RUN_US, 0, 0);
+    printf("slowest, SMCLK: %u samples, %u missed\n", (unsigned)Samples, Missed);
+    TEST__CHECK_RANGE(Samples, (SLOW_RUN_US / 1e6) * ADC__MIN_SAMPLE_HZ * 0.9, (SLOW_RUN_US / 1e6) * ADC__MIN_SAMPLE_HZ + 1);
+    TEST__CHECK(Missed == 0);
+
+    //Refused without a crystal too, where Timer A runs from SMCLK
+    HOSTSIM__PowerOn();
+    HOSTSIM__Run(ControlEntry, 100000);
+    TEST__CHECK(StartRefused);
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__Run(ControlEntry, 100000);
+    TEST__CHECK(StartRefused);
+
+    return TEST__Result("adc_timed");
+}
@@ -0,0 +1,443 @@
+// *****************************************************************************
+// *  File: test_dsp.c
+// *
+// *  Purpose:
+// *  Bit exact checks of the DSP kernels against plain C references using
+// *  wide arithmetic. The inputs are fed in blocks of random length, so the
+// *  state carried between calls is checked along with the arithmetic. The
+// *  IIR filters are also checked against the unquantised filters in double
+// *  precision.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+#include <math.h>
+
+#define NUM_SAMPLES                 4096
+#define NUM_INPUT_SETS              4
+#define MAX_BLOCK                   200
+
+// Private variables defined here
+static int16_t Input[NUM_SAMPLES];
+static int16_t Output[NUM_SAMPLES + 1];
+static int64_t Integrator[DSP__CIC_MAX_ORDER][NUM_SAMPLES];
+static uint32_t Random;
+
+//*****************************************************************************
+// Purpose: Pseudo random numbers, the same sequence on every host.
+// Argument: None
+// Return: Random number, 0 to 32767
+//
+//*****************************************************************************
+
+static uint16_t NextRandom(void)
+{
+    Random = (Random * 1103515245) + 12345;
+
+    return (Random >> 16) & 0x7FFF;
+}
+
+//*****************************************************************************
+// Purpose: Random block length for feeding an input through a kernel.
+// Argument: position - Samples already fed
+// Return: Block length, at least 1
+//
+//*****************************************************************************
+
+static uint16_t BlockLength(uint16_t position)
+{
+    uint16_t length = 1 + (NextRandom() % MAX_BLOCK);
+
+    return (position + length > NUM_SAMPLES) ? (NUM_SAMPLES - position) : length;
+}
+
+//*****************************************************************************
+// Purpose: Fill the input with a test signal. Even sets are a noisy sine
+//          wave in the ADC10 range, odd sets are full scale noise.
+// Argument: set - Input set number
+// Return: None
+//
+//*****************************************************************************
+
+static void MakeInput(uint8_t set)
+{
+    uint16_t index;
+    int32_t value;
+
+    Random = set;
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        if(set & 1)
+        {
+            value = (int32_t)(((uint32_t)NextRandom() << 1) ^ NextRandom()) % (DSP__MAX_SAMPLE - DSP__MIN_SAMPLE + 1) + DSP__MIN_SAMPLE;
+        }
+        else
+        {
+            value = 500 + (int32_t)lround(400 * sin(index * (0.013 + 0.002 * set))) + (NextRandom() % 101) - 50;
+        }
+
+        Input[index] = (int16_t)value;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Check a CIC decimator against cascaded running sums with the comb
+//          applied as the binomial expansion of (1 - z^-R)^order.
+// Argument: order - Number of stages
+//           shift - Decimation rate as a power of 2
+// Return: None
+//
+//*****************************************************************************
+
+static void CheckCic(uint8_t order, uint8_t shift)
+{
+    DSP__Cic_t cic;
+    uint16_t outputs = 0;
+    uint16_t position = 0;
+    uint16_t length;
+    uint16_t output;
+    uint16_t stage;
+    uint16_t index;
+    int32_t at;
+    int64_t coefficient;
+    int64_t sum;
+    int64_t expected;
+    uint8_t growth = order * shift;
+    uint32_t mismatches = 0;
+
+    TEST__CHECK(DSP__CicInit(&cic, order, shift));
+
+    while(position < NUM_SAMPLES)
+    {
+        length = BlockLength(position);
+        outputs += DSP__CicDecimate(&cic, Input + position, length, Output + outputs);
+        position += length;
+    }
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        sum = Input[index];
+
+        for(stage = 0; stage < order; stage++)
+        {
+            sum += (index > 0) ? Integrator[stage][index - 1] : 0;
+            Integrator[stage][index] = sum;
+        }
+    }
+
+    TEST__CHECK(outputs == (NUM_SAMPLES >> shift));
+
+    for(output = 0; output < outputs; output++)
+    {
+        sum = 0;
+        coefficient = 1;
+
+        for(stage = 0; stage <= order; stage++)
+        {
+            at = (((int32_t)output + 1) << shift) - 1 - ((int32_t)stage << shift);
+
+            if(at >= 0)
+            {
+                sum += (stage & 1) ? -(coefficient * Integrator[order - 1][at]) : (coefficient * Integrator[order - 1][at]);
+            }
+
+            coefficient = (coefficient * (order - stage)) / (stage + 1);
+        }
+
+        expected = (growth > 0) ? ((sum + ((int64_t)1 << (growth - 1))) >> growth) : sum;
+
+        if(Output[output] != expected)
+        {
+            mismatches++;
+        }
+    }
+
+    if(mismatches != 0)
+    {
+        printf("CIC order %u shift %u: %u mismatches\n", order, shift, (unsigned)mismatches);
+    }
+
+    TEST__CHECK(mismatches == 0);
+}
+
+//*****************************************************************************
+// Purpose: Check an IIR filter against the smoothing sections computed in 64
+//          bit arithmetic.
+// Argument: order - Number of sections
+//           shift - Smoothing shift
+//           response - DSP__IIR_LOWPASS or DSP__IIR_HIGHPASS
+// Return: None
+//
+//*****************************************************************************
+
+static void CheckIir(uint8_t order, uint8_t shift, uint8_t response)
+{
+    DSP__Iir_t filter;
+    uint16_t position = 0;
+    uint16_t length;
+    uint16_t index;
+    int64_t first = (int64_t)Input[0] * ((int64_t)1 << DSP__IIR_FRACTION_BITS);
+    int64_t second = first;
+    int64_t lowpass;
+    int64_t expected;
+    uint32_t mismatches = 0;
+
+    TEST__CHECK(DSP__IirInit(&filter, order, shift, response, Input[0]));
+
+    while(position < NUM_SAMPLES)
+    {
+        length = BlockLength(position);
+        DSP__IirFilter(&filter, Input + position, length, Output + position);
+        position += length;
+    }
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        first += (((int64_t)Input[index] * ((int64_t)1 << DSP__IIR_FRACTION_BITS)) - first) >> shift;
+        lowpass = first;
+
+        if(order > 1)
+        {
+            second += (first - second) >> shift;
+            lowpass = second;
+        }
+
+        expected = (lowpass + ((int64_t)1 << (DSP__IIR_FRACTION_BITS - 1))) >> DSP__IIR_FRACTION_BITS;
+
+        if(response == DSP__IIR_HIGHPASS)
+        {
+            expected = Input[index] - expected;
+        }
+
+        if(Output[index] != expected)
+        {
+            mismatches++;
+        }
+    }
+
+    if(mismatches != 0)
+    {
+        printf("IIR order %u shift %u response %u: %u mismatches\n", order, shift, response, (unsigned)mismatches);
+    }
+
+    TEST__CHECK(mismatches == 0);
+}
+
+//*****************************************************************************
+// Purpose: Check an IIR filter against the unquantised filter in double
+//          precision. The output is rounded to within 1/2 LSB, and each
+//          section's state update truncates below 2^-16, which builds up
+//          to a bias of up to 2^(shift - 16) LSB.
+// Argument: order - Number of sections
+//           shift - Smoothing shift of each section
+//           response - DSP__IIR_LOWPASS or DSP__IIR_HIGHPASS
+// Return: Largest error in LSB
+//
+//*****************************************************************************
+
+static double CheckIirReference(uint8_t order, uint8_t shift, uint8_t response)
+{
+    DSP__Iir_t filter;
+    uint16_t index;
+    double first = Input[0];
+    double second = first;
+    double expected;
+    double error;
+    double maxError = 0;
+    double bound = 0.5 + (order * ldexp(1.0, shift - DSP__IIR_FRACTION_BITS)) + 1e-9;
+
+    TEST__CHECK(DSP__IirInit(&filter, order, shift, response, Input[0]));
+    DSP__IirFilter(&filter, Input, NUM_SAMPLES, Output);
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        first += (Input[index] - first) / ldexp(1.0, shift);
+        second += (first - second) / ldexp(1.0, shift);
+        expected = (order > 1) ? second : first;
+
+        if(response == DSP__IIR_HIGHPASS)
+        {
+            expected = Input[index] - expected;
+        }
+
+        error = fabs(Output[index] - expected);
+
+        if(error > maxError)
+        {
+            maxError = error;
+        }
+    }
+
+    if(maxError > bound)
+    {
+        printf("IIR order %u shift %u response %u: %.3f LSB from the double filter, bound %.3f\n", order, shift, response, maxError, bound);
+    }
+
+    TEST__CHECK(maxError <= bound);
+
+    return maxError;
+}
+
+//*****************************************************************************
+// Purpose: Check the block statistics against sums over the whole input.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void CheckStats(void)
+{
+    DSP__Stats_t stats;
+    uint16_t position = 0;
+    uint16_t length;
+    uint16_t index;
+    int16_t min = DSP__MAX_SAMPLE;
+    int16_t max = DSP__MIN_SAMPLE;
+    int64_t sum = 0;
+    uint64_t squares = 0;
+    int64_t mean;
+    uint64_t rms;
+
+    DSP__StatsReset(&stats);
+
+    while(position < NUM_SAMPLES)
+    {
+        length = BlockLength(position);
+        DSP__StatsUpdate(&stats, Input + position, length);
+        position += length;
+    }
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        min = (Input[index] < min) ? Input[index] : min;
+        max = (Input[index] > max) ? Input[index] : max;
+        sum += Input[index];
+        squares += (uint64_t)((int32_t)Input[index] * Input[index]);
+    }
+
+    //Mean rounded half away from zero, rms rounded down
+    mean = (sum < 0) ? -((-sum + (NUM_SAMPLES / 2)) / NUM_SAMPLES) : ((sum + (NUM_SAMPLES / 2)) / NUM_SAMPLES);
+    rms = (uint64_t)sqrt((double)(squares / NUM_SAMPLES));
+
+    TEST__CHECK(stats.count == NUM_SAMPLES);
+    TEST__CHECK(stats.min == min);
+    TEST__CHECK(stats.max == max);
+    TEST__CHECK(DSP__StatsMean(&stats) == mean);
+    TEST__CHECK(DSP__StatsRms(&stats) == rms);
+}
+
+//*****************************************************************************
+// Purpose: Check the threshold detector against a sample by sample state.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void CheckThreshold(void)
+{
+    DSP__Threshold_t detector;
+    uint16_t position = 0;
+    uint16_t length;
+    uint16_t index;
+    uint32_t changes = 0;
+    uint32_t expected = 0;
+    bool above = false;
+
+    DSP__ThresholdInit(&detector, 700, 300, false);
+
+    while(position < NUM_SAMPLES)
+    {
+        length = BlockLength(position);
+        changes += DSP__ThresholdDetect(&detector, Input + position, length);
+        position += length;
+    }
+
+    for(index = 0; index < NUM_SAMPLES; index++)
+    {
+        if((!above && (Input[index] >= 700)) || (above && (Input[index] <= 300)))
+        {
+            above = !above;
+            expected++;
+        }
+    }
+
+    TEST__CHECK(changes == expected);
+    TEST__CHECK(detector.above == above);
+}
+
+int main(void)
+{
+    uint8_t set;
+    uint8_t order;
+    uint8_t shift;
+    uint8_t response;
+    uint32_t value;
+    uint32_t index;
+    uint32_t mismatches = 0;
+    double error;
+    double maxError = 0;
+
+    for(set = 0; set < NUM_INPUT_SETS; set++)
+    {
+        MakeInput(set);
+
+        for(order = 1; order <= DSP__CIC_MAX_ORDER; order++)
+        {
+            for(shift = 0; (shift <= DSP__CIC_MAX_SHIFT) && ((order * shift) <= DSP__CIC_MAX_GROWTH); shift++)
+            {
+                CheckCic(order, shift);
+            }
+        }
+
+        for(order = 1; order <= 2; order++)
+        {
+            for(shift = 0; shift <= DSP__IIR_MAX_SHIFT; shift += 3)
+            {
+                for(response = DSP__IIR_LOWPASS; response <= DSP__IIR_HIGHPASS; response++)
+                {
+                    CheckIir(order, shift, response);
+                    error = CheckIirReference(order, shift, response);
+
+                    if(error > maxError)
+                    {
+                        maxError = error;
+                    }
+                }
+            }
+        }
+
+        CheckStats();
+        CheckThreshold();
+    }
+
+    printf("dsp: IIR within %.3f LSB of the double precision filters\n", maxError);
+
+    //Every value up to 2^20, then random values over the full range
+    for(index = 0; index < 2000000; index++)
+    {
+        value = (index < 0x100000) ? index : (((uint32_t)NextRandom() << 17) ^ ((uint32_t)NextRandom() << 2) ^ index);
+
+        if(DSP__SquareRoot(value) != (uint32_t)sqrt((double)value))
+        {
+            mismatches++;
+        }
+    }
+
+    TEST__CHECK(mismatches == 0);
+
+    //Configurations beyond the limits are refused
+    TEST__CHECK(!DSP__CicInit(&(DSP__Cic_t){0}, DSP__CIC_MAX_ORDER + 1, 1));
+    TEST__CHECK(!DSP__CicInit(&(DSP__Cic_t){0}, 1, DSP__CIC_MAX_SHIFT + 1));
+    TEST__CHECK(!DSP__CicInit(&(DSP__Cic_t){0}, 2, (DSP__CIC_MAX_GROWTH / 2) + 1));
+    TEST__CHECK(!DSP__IirInit(&(DSP__Iir_t){0}, 1, DSP__IIR_MAX_SHIFT + 1, DSP__IIR_LOWPASS, 0));
+    TEST__CHECK(LIBUTIL__IsErrorLogged(DSP__INVALID_CONFIG));
+
+    return TEST__Result("dsp");
+}
@@ -0,0 +1,109 @@
+// *****************************************************************************
+// *  File: test_hostsim.c
+// *
+// *  Purpose:
+// *  Checks of the host register simulator itself: Timer A counting on SMCLK,
+// *  low power mode wake up from an interrupt, port output and the run time
+// *  limit.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+// Private variables defined here
+static uint16_t TimerCounts;
+static uint32_t Wakeups;
+static uint8_t PortHigh;
+static uint8_t PortLow;
+
+//*****************************************************************************
+// Purpose: Timer A CC0 handler, counts the wake ups from low power mode.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void CompareHandler(void)
+{
+    Wakeups++;
+    HWREG16(TIMERA_TACCR0_REG_ADDR) += 1000;
+    HOSTSIM__BicSROnExit(LPM4_bits);
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, measures Timer A, sleeps on the CC0 interrupt
+//          and drives a port pin. Returns to end the run.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    uint16_t start;
+    uint8_t index;
+
+    HW__InitialiseSystem();
+
+    start = HWREG16(TIMERA_TAR_REG_ADDR);
+    HOSTSIM__Delay(1000);
+    TimerCounts = HWREG16(TIMERA_TAR_REG_ADDR) - start;
+
+    HOSTSIM__SetVector(TIMERA0_VECTOR, CompareHandler);
+    HWREG16(TIMERA_TACCR0_REG_ADDR) = HWREG16(TIMERA_TAR_REG_ADDR) + 1000;
+    HWREG16(TIMERA_TACCTL0_REG_ADDR) = TIMERA_CCIE_MASK;
+
+    for(index = 0; index < 10; index++)
+    {
+        _bis_SR_register(LPM0_bits + GIE);
+    }
+
+    _disable_interrupts();
+
+    GPIO_configurePin(GPIO_IOID3, SET_AS_OUTPUT);
+    GPIO_set(GPIO_PIN(GPIO_IOID3));
+    PortHigh = HOSTSIM__GetPortOutput(MSP_PORT1);
+    GPIO_clear(GPIO_PIN(GPIO_IOID3));
+    PortLow = HOSTSIM__GetPortOutput(MSP_PORT1);
+}
+
+//*****************************************************************************
+// Purpose: Simulated program which never returns.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Forever(void)
+{
+    for(;;)
+    {
+        HOSTSIM__Delay(100);
+    }
+}
+
+int main(void)
+{
+    uint64_t start;
+
+    HOSTSIM__PowerOn();
+    TEST__CHECK(HOSTSIM__Run(Entry, 100000) == HOSTSIM__RUN_RETURNED);
+
+    //One count per SMCLK cycle, the register reads are charged a few cycles
+    TEST__CHECK_RANGE(TimerCounts, 1000, 1020);
+    TEST__CHECK(Wakeups == 10);
+    TEST__CHECK(PortHigh & MSP_PORT_IO3);
+    TEST__CHECK(!(PortLow & MSP_PORT_IO3));
+
+    start = HOSTSIM__GetTimeNs();
+    TEST__CHECK(HOSTSIM__Run(Forever, 5000) == HOSTSIM__RUN_TIME_LIMIT);
+    TEST__CHECK_RANGE(HOSTSIM__GetTimeNs() - start, 5000000, 5001000);
+
+    return TEST__Result("hostsim");
+}
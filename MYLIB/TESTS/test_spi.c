@@ -0,0 +1,316 @@
+// *****************************************************************************
+// *  File: test_spi.c
+// *
+// *  Purpose:
+// *  Checks of the USI SPI master queue: transfers to two devices are chained
+// *  from the interrupt handler and requeued from their callbacks, every byte
+// *  is shifted with only its own device selected, received bytes land in the
+// *  right buffers, and a chip select held by keep_selected is released before
+// *  another device is selected and kept for the same device. Short
+// *  transfers queued now and then from a soft timer leave the idle path in
+// *  LPM3 between them once the USI handler releases SMCLK.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "hosttest.h"
+
+#define NUM_TRANSFERS               4
+#define MAX_LENGTH                  16
+#define TOTAL_TRANSFERS             40
+#define SLAVE_XOR                   0x5A    //Slave answers each byte with the byte xor this
+
+#define DEVICE_A                    GPIO_IOID0
+#define DEVICE_B                    GPIO_IOID4
+#define SELECT_MASK                 (MSP_PORT_IO0 | MSP_PORT_IO4)
+
+#define IDLE_PERIOD_MS              10      //Transfer queued every period in the idle run
+#define IDLE_RUN_US                 2000000
+#define IDLE_SAMPLE_US              997     //Low power mode sampled every step
+
+// Private variables defined here
+static SPI__Transfer_t Transfers[NUM_TRANSFERS];
+static uint8_t Tx[NUM_TRANSFERS][MAX_LENGTH];
+static uint8_t Rx[NUM_TRANSFERS][MAX_LENGTH];
+static const uint8_t Lengths[NUM_TRANSFERS] = {16, 5, 1, 9};
+static const uint8_t Devices[NUM_TRANSFERS] = {DEVICE_A, DEVICE_B, DEVICE_A, DEVICE_A};
+static const bool Keep[NUM_TRANSFERS] = {false, true, false, true};
+static uint8_t SlaveTransfer;       //Transfer the slave expects the next byte from
+static uint8_t SlaveByte;
+static uint32_t SlaveBytes;
+static uint32_t SelectErrors;       //Bytes shifted without exactly the right device selected
+static uint32_t DataErrors;
+static uint32_t HoldErrors;         //Chip selects in the wrong state at completion
+static uint32_t Done;
+static uint32_t Random = 1;
+static bool QueueRefused;
+static uint8_t HeldOutput;
+static uint8_t ResetOutput;
+static uint32_t IdleTransfers;
+static uint32_t IdleSamples;
+static uint32_t Lpm3Samples;
+
+//*****************************************************************************
+// Purpose: Pseudo random bytes, the same sequence on every host.
+// Argument: None
+// Return: Random byte
+//
+//*****************************************************************************
+
+static uint8_t NextRandom(void)
+{
+    Random = (Random * 1103515245) + 12345;
+
+    return (Random >> 16) & 0xFF;
+}
+
+//*****************************************************************************
+// Purpose: Simulated SPI slave, checks the chip selects of each byte.
+// Argument: mosi - Byte sent by the master
+// Return: Byte shifted out by the slave during the next byte
+//
+//*****************************************************************************
+
+static uint8_t Slave(uint8_t mosi)
+{
+    uint8_t selected = ~HOSTSIM__GetPortOutput(MSP_PORT1) & SELECT_MASK;
+
+    if(selected != GPIO_PIN(Devices[SlaveTransfer]).pin_mask)
+    {
+        SelectErrors++;
+    }
+
+    if(++SlaveByte == Lengths[SlaveTransfer])
+    {
+        SlaveByte = 0;
+        SlaveTransfer = (SlaveTransfer + 1) % NUM_TRANSFERS;
+    }
+
+    SlaveBytes++;
+
+    return mosi ^ SLAVE_XOR;
+}
+
+//*****************************************************************************
+// Purpose: Transfer complete callback, checks the received bytes and the
+//          chip select, then queues the transfer again with new data.
+// Argument: transfer - Completed transfer
+// Return: None
+//
+//*****************************************************************************
+
+static void TransferDone(SPI__Transfer_t *transfer)
+{
+    uint8_t number = transfer - Transfers;
+    uint8_t selected = ~HOSTSIM__GetPortOutput(MSP_PORT1) & transfer->chip_select.pin_mask;
+    uint16_t index;
+
+    //The next transfer is already running and only its device is selected,
+    //with the bus idle a held device stays selected
+    if((selected != 0) != (SPI__IsBusy() ? (Devices[(number + 1) % NUM_TRANSFERS] == Devices[number]) : transfer->keep_selected))
+    {
+        HoldErrors++;
+    }
+
+    //Each byte is answered during the byte after it
+    for(index = 1; index < transfer->length; index++)
+    {
+        if(transfer->rx[index] != (transfer->tx[index - 1] ^ SLAVE_XOR))
+        {
+            DataErrors++;
+        }
+    }
+
+    for(index = 0; index < transfer->length; index++)
+    {
+        Tx[number][index] = NextRandom();
+    }
+
+    if(++Done <= (TOTAL_TRANSFERS - NUM_TRANSFERS))
+    {
+        SPI__Queue(transfer);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, queues the transfers and waits for the chain
+//          to run out.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void Entry(void)
+{
+    SPI__Transfer_t empty = {GPIO_PIN(DEVICE_A), 0, 0, 0, false, 0, 0, SPI__TRANSFER_DONE};
+    uint8_t number;
+    uint8_t index;
+
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    GPIO_reset();
+    SPI__Reset();
+
+    GPIO_configurePin(DEVICE_A, SET_AS_OUTPUT);
+    GPIO_set(GPIO_PIN(DEVICE_A));
+    GPIO_configurePin(DEVICE_B, SET_AS_OUTPUT);
+    GPIO_set(GPIO_PIN(DEVICE_B));
+
+    for(number = 0; number < NUM_TRANSFERS; number++)
+    {
+        Transfers[number].chip_select = GPIO_PIN(Devices[number]);
+        Transfers[number].tx = Tx[number];
+        Transfers[number].rx = Rx[number];
+        Transfers[number].length = Lengths[number];
+        Transfers[number].keep_selected = Keep[number];
+        Transfers[number].callback = TransferDone;
+
+        for(index = 0; index < MAX_LENGTH; index++)
+        {
+            Tx[number][index] = NextRandom();
+        }
+
+        TEST__CHECK(SPI__Queue(&Transfers[number]));
+    }
+
+    //Already queued or empty transfers are refused
+    QueueRefused = !SPI__Queue(&Transfers[0]) && !SPI__Queue(&empty);
+
+    while(SPI__IsBusy())
+    {
+        HOSTSIM__Delay(10);
+    }
+
+    //The last transfer keeps its device selected until the queue is reset
+    HeldOutput = HOSTSIM__GetPortOutput(MSP_PORT1);
+    SPI__Reset();
+    ResetOutput = HOSTSIM__GetPortOutput(MSP_PORT1);
+}
+
+//*****************************************************************************
+// Purpose: Soft timer callback, queues a short transfer unless the last one
+//          is still running.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void IdleTimer(void)
+{
+    if(SPI__Queue(&Transfers[0]))
+    {
+        IdleTransfers++;
+    }
+}
+
+//*****************************************************************************
+// Purpose: Scheduler task running the expired soft timer callbacks.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void SoftTimerTask(uint16_t events)
+{
+    (void)events;
+    SOFTTMR__ProcessCallbacks();
+}
+
+//*****************************************************************************
+// Purpose: Stimulus event, counts the samples taken in LPM3.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void SampleLowpower(void)
+{
+    IdleSamples++;
+
+    if((HOSTSIM__GetSR() & LPM4_bits) == LPM3_bits)
+    {
+        Lpm3Samples++;
+    }
+
+    HOSTSIM__ScheduleEvent(IDLE_SAMPLE_US, SampleLowpower);
+}
+
+//*****************************************************************************
+// Purpose: Simulated program, queues a 2 byte transfer every period from the
+//          scheduler and sleeps in between.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void IdleEntry(void)
+{
+    HW__InitialiseSystem();
+    INT__EnableInterrupts();
+    SOFTTMR__Reset();
+    UPTIME__Reset();
+    GPIO_reset();
+    SPI__Reset();
+
+    GPIO_configurePin(DEVICE_A, SET_AS_OUTPUT);
+    GPIO_set(GPIO_PIN(DEVICE_A));
+
+    Transfers[0].chip_select = GPIO_PIN(DEVICE_A);
+    Transfers[0].tx = Tx[0];
+    Transfers[0].rx = Rx[0];
+    Transfers[0].length = 2;
+    Transfers[0].keep_selected = false;
+    Transfers[0].callback = 0;
+
+    SCHED__Init();
+    SCHED__RegisterTask(SCHED__SOFTTMR_TASK, SoftTimerTask);
+    SOFTTMR__RegisterCallback(SOFTTMR__RES_1MS, LED_SOFT_TIMER_2, IdleTimer, IDLE_PERIOD_MS, SOFTTMR__AUTO_RELOAD);
+
+    HOSTSIM__ScheduleEvent(IDLE_SAMPLE_US, SampleLowpower);
+    SCHED__Run();
+}
+
+int main(void)
+{
+    uint32_t bytes = 0;
+    uint8_t number;
+
+    for(number = 0; number < NUM_TRANSFERS; number++)
+    {
+        bytes += Lengths[number];
+    }
+
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__SetSpiSlave(Slave);
+    TEST__CHECK(HOSTSIM__Run(Entry, 1000000) == HOSTSIM__RUN_RETURNED);
+
+    printf("spi: %u transfers, %u bytes\n", (unsigned)Done, (unsigned)SlaveBytes);
+    TEST__CHECK(Done == TOTAL_TRANSFERS);
+    TEST__CHECK(SlaveBytes == bytes * (TOTAL_TRANSFERS / NUM_TRANSFERS));
+    TEST__CHECK(SelectErrors == 0);
+    TEST__CHECK(DataErrors == 0);
+    TEST__CHECK(HoldErrors == 0);
+    TEST__CHECK(QueueRefused);
+    TEST__CHECK(LIBUTIL__IsErrorLogged(SPI__INVALID_TRANSFER));
+    TEST__CHECK((HeldOutput & SELECT_MASK) == MSP_PORT_IO4);
+    TEST__CHECK((ResetOutput & SELECT_MASK) == SELECT_MASK);
+
+    //Each transfer takes well under a sample step, nearly every sample falls
+    //between transfers with SMCLK released
+    HOSTSIM__PowerOn();
+    HOSTSIM__SetCrystal(true, HOSTSIM__LFXT1_STARTUP_US);
+    HOSTSIM__SetSpiSlave(0);
+    HOSTSIM__Run(IdleEntry, IDLE_RUN_US);
+
+    printf("spi idle: %u transfers, %u of %u samples in LPM3\n", (unsigned)IdleTransfers, (unsigned)Lpm3Samples, (unsigned)IdleSamples);
+    TEST__CHECK_RANGE(IdleTransfers, (IDLE_RUN_US / 1000 / IDLE_PERIOD_MS) - 2, (IDLE_RUN_US / 1000 / IDLE_PERIOD_MS) + 1);
+    TEST__CHECK(Lpm3Samples >= (IdleSamples * 9) / 10);
+
+    return TEST__Result("spi");
+}
@@ -0,0 +1,446 @@
+// *****************************************************************************
+// *  File: dsp.c
+// *
+// *  Purpose:
+// *  Fixed point signal processing kernels. Products are only formed where a
+// *  result is read out, by shift and add loops which stop at the highest set
+// *  bit, as the library multiply and 64 bit divide routines cost more flash
+// *  than the kernels themselves.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "dsp.h"
+
+//*****************************************************************************
+// Purpose: Square a sample magnitude by shift and add, one step per bit up to
+//          the highest set bit, 10 steps for an ADC10 result.
+// Argument: value - Sample magnitude
+// Return: Square of the value
+//
+//*****************************************************************************
+
+static uint32_t Square(uint16_t value)
+{
+    uint32_t addend = value;
+    uint32_t result = 0;
+
+    while(value != 0)
+    {
+        if(value & 1)
+        {
+            result += addend;
+        }
+
+        addend <<= 1;
+        value >>= 1;
+    }
+
+    return result;
+}
+
+//*****************************************************************************
+// Purpose: Divide by restoring shift and subtract division, used where a
+//          result is read out rather than per sample.
+// Argument: dividend - Value to divide
+//           divisor - Non zero divisor
+// Return: Quotient, saturated to 32 bits
+//
+//*****************************************************************************
+
+static uint32_t Divide(uint64_t dividend, uint16_t divisor)
+{
+    uint32_t remainder = 0;
+    uint32_t quotient = 0;
+    uint8_t bit = 64;
+
+    while(bit-- > 0)
+    {
+        remainder = (remainder << 1) | (uint32_t)((dividend >> bit) & 1);
+
+        if(remainder >= divisor)
+        {
+            remainder -= divisor;
+
+            if(bit >= 32)
+            {
+                return 0xFFFFFFFF;
+            }
+
+            quotient |= (uint32_t)1 << bit;
+        }
+    }
+
+    return quotient;
+}
+
+//*****************************************************************************
+// Purpose: Scale a sample into an IIR filter state.
+// Argument: sample - Sample value
+// Return: Sample scaled by 2^DSP__IIR_FRACTION_BITS
+//
+//*****************************************************************************
+
+static inline int32_t ToState(int16_t sample)
+{
+    return (int32_t)((uint32_t)(int32_t)sample << DSP__IIR_FRACTION_BITS);
+}
+
+//*****************************************************************************
+// Purpose: Round an IIR filter state to a sample.
+// Argument: state - Filter state
+// Return: Nearest sample value
+//
+//*****************************************************************************
+
+static inline int16_t FromState(int32_t state)
+{
+    return (int16_t)((state + ((int32_t)1 << (DSP__IIR_FRACTION_BITS - 1))) >> DSP__IIR_FRACTION_BITS);
+}
+
+//*****************************************************************************
+// Purpose: Initialise a CIC decimator with cleared integrators.
+// Argument: cic - Decimator
+//           order - Number of integrator and comb stages, 1 to 3
+//           shift - Decimation rate as a power of 2, up to 15 and
+//                   order x shift up to 16
+// Return: True if the configuration is valid
+//
+//*****************************************************************************
+
+bool DSP__CicInit(DSP__Cic_t *cic, uint8_t order, uint8_t shift)
+{
+    uint8_t stage;
+
+    if((order == 0) || (order > DSP__CIC_MAX_ORDER) || (shift > DSP__CIC_MAX_SHIFT) || ((order * shift) > DSP__CIC_MAX_GROWTH))
+    {
+        LIBUTIL__LogError(DSP__INVALID_CONFIG);
+        return false;
+    }
+
+    for(stage = 0; stage < DSP__CIC_MAX_ORDER; stage++)
+    {
+        cic->integrator[stage] = 0;
+        cic->comb[stage] = 0;
+    }
+
+    cic->order = order;
+    cic->shift = shift;
+    cic->count = 0;
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Decimate a block of samples. The integrators run at the input
+//          rate and wrap around, the comb stages run once per output sample
+//          and recover the exact sum. The output is the sum scaled back by
+//          the CIC gain of 2^(order x shift), rounded. A partial group is
+//          carried into the next block.
+// Argument: cic - Decimator
+//           in - Input samples
+//           length - Number of input samples
+//           out - Output samples, room for length / 2^shift + 1
+// Return: Number of output samples written
+//
+//*****************************************************************************
+
+uint16_t DSP__CicDecimate(DSP__Cic_t *cic, const int16_t *in, uint16_t length, int16_t *out)
+{
+    uint16_t rate = (uint16_t)1 << cic->shift;
+    uint8_t growth = cic->order * cic->shift;
+    uint16_t written = 0;
+    uint32_t value;
+    uint32_t previous;
+    uint8_t stage;
+
+    while(length-- > 0)
+    {
+        value = (uint32_t)(int32_t)*in++;
+
+        for(stage = 0; stage < cic->order; stage++)
+        {
+            cic->integrator[stage] += value;
+            value = cic->integrator[stage];
+        }
+
+        if(++cic->count >= rate)
+        {
+            cic->count = 0;
+
+            for(stage = 0; stage < cic->order; stage++)
+            {
+                previous = cic->comb[stage];
+                cic->comb[stage] = value;
+                value -= previous;
+            }
+
+            if(growth > 0)
+            {
+                value += (uint32_t)1 << (growth - 1);
+            }
+
+            out[written++] = (int16_t)((int32_t)value >> growth);
+        }
+    }
+
+    return written;
+}
+
+//*****************************************************************************
+// Purpose: Initialise an IIR filter settled at a starting value, which avoids
+//          the start up transient of a filter started from zero.
+// Argument: filter - Filter
+//           order - Number of smoothing sections, 1 or 2
+//           shift - Smoothing shift of each section, 0 to 15
+//           response - DSP__IIR_LOWPASS or DSP__IIR_HIGHPASS
+//           initial - Input value the filter starts settled at
+// Return: True if the configuration is valid
+//
+//*****************************************************************************
+
+bool DSP__IirInit(DSP__Iir_t *filter, uint8_t order, uint8_t shift, uint8_t response, int16_t initial)
+{
+    if((order == 0) || (order > 2) || (shift > DSP__IIR_MAX_SHIFT) || (response > DSP__IIR_HIGHPASS))
+    {
+        LIBUTIL__LogError(DSP__INVALID_CONFIG);
+        return false;
+    }
+
+    filter->state[0] = ToState(initial);
+    filter->state[1] = ToState(initial);
+    filter->order = order;
+    filter->shift = shift;
+    filter->response = response;
+
+    return true;
+}
+
+//*****************************************************************************
+// Purpose: Filter a block of samples. The input and output may be the same
+//          buffer.
+// Argument: filter - Filter
+//           in - Input samples
+//           length - Number of samples
+//           out - Output samples
+// Return: None
+//
+//*****************************************************************************
+
+void DSP__IirFilter(DSP__Iir_t *filter, const int16_t *in, uint16_t length, int16_t *out)
+{
+    int32_t first = filter->state[0];
+    int32_t second = filter->state[1];
+    uint8_t shift = filter->shift;
+    int32_t lowpass;
+    int16_t sample;
+
+    while(length-- > 0)
+    {
+        sample = *in++;
+
+        first += (ToState(sample) - first) >> shift;
+        lowpass = first;
+
+        if(filter->order > 1)
+        {
+            second += (first - second) >> shift;
+            lowpass = second;
+        }
+
+        if(filter->response == DSP__IIR_HIGHPASS)
+        {
+            *out++ = sample - FromState(lowpass);
+        }
+        else
+        {
+            *out++ = FromState(lowpass);
+        }
+    }
+
+    filter->state[0] = first;
+    filter->state[1] = second;
+}
+
+//*****************************************************************************
+// Purpose: Clear block statistics.
+// Argument: stats - Statistics
+// Return: None
+//
+//*****************************************************************************
+
+void DSP__StatsReset(DSP__Stats_t *stats)
+{
+    stats->min = DSP__MAX_SAMPLE;
+    stats->max = DSP__MIN_SAMPLE;
+    stats->sum = 0;
+    stats->sum_squares = 0;
+    stats->count = 0;
+}
+
+//*****************************************************************************
+// Purpose: Accumulate a block of samples into the statistics, up to 65535
+//          samples in all.
+// Argument: stats - Statistics
+//           in - Input samples
+//           length - Number of samples
+// Return: None
+//
+//*****************************************************************************
+
+void DSP__StatsUpdate(DSP__Stats_t *stats, const int16_t *in, uint16_t length)
+{
+    int16_t sample;
+
+    stats->count += length;
+
+    while(length-- > 0)
+    {
+        sample = *in++;
+
+        if(sample < stats->min)
+        {
+            stats->min = sample;
+        }
+
+        if(sample > stats->max)
+        {
+            stats->max = sample;
+        }
+
+        stats->sum += sample;
+        stats->sum_squares += Square((sample < 0) ? (uint16_t)-sample : (uint16_t)sample);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Mean of the accumulated samples, rounded.
+// Argument: stats - Statistics
+// Return: Mean, 0 with no samples
+//
+//*****************************************************************************
+
+int16_t DSP__StatsMean(const DSP__Stats_t *stats)
+{
+    uint32_t magnitude;
+
+    if(stats->count == 0)
+    {
+        return 0;
+    }
+
+    magnitude = (stats->sum < 0) ? (uint32_t)-stats->sum : (uint32_t)stats->sum;
+    magnitude = Divide(magnitude + (stats->count / 2), stats->count);
+
+    return (stats->sum < 0) ? -(int16_t)magnitude : (int16_t)magnitude;
+}
+
+//*****************************************************************************
+// Purpose: Root mean square of the accumulated samples, the DC level
+//          included. High pass filter the samples first for the AC level.
+// Argument: stats - Statistics
+// Return: RMS value, rounded down, 0 with no samples
+//
+//*****************************************************************************
+
+uint16_t DSP__StatsRms(const DSP__Stats_t *stats)
+{
+    if(stats->count == 0)
+    {
+        return 0;
+    }
+
+    return DSP__SquareRoot(Divide(stats->sum_squares, stats->count));
+}
+
+//*****************************************************************************
+// Purpose: Initialise a threshold detector.
+// Argument: detector - Detector
+//           high - Level at which the state changes to above
+//           low - Level at which the state changes to below, at most high
+//           above - Starting state
+// Return: None
+//
+//*****************************************************************************
+
+void DSP__ThresholdInit(DSP__Threshold_t *detector, int16_t high, int16_t low, bool above)
+{
+    if(low > high)
+    {
+        LIBUTIL__LogError(DSP__INVALID_CONFIG);
+        low = high;
+    }
+
+    detector->high = high;
+    detector->low = low;
+    detector->above = above;
+    detector->index = 0;
+}
+
+//*****************************************************************************
+// Purpose: Run a block of samples through a threshold detector.
+// Argument: detector - Detector, holds the state at the end of the block and
+//                      the index of the last state change
+//           in - Input samples
+//           length - Number of samples
+// Return: Number of state changes in the block
+//
+//*****************************************************************************
+
+uint16_t DSP__ThresholdDetect(DSP__Threshold_t *detector, const int16_t *in, uint16_t length)
+{
+    uint16_t changes = 0;
+    uint16_t index;
+
+    for(index = 0; index < length; index++)
+    {
+        if(detector->above ? (in[index] <= detector->low) : (in[index] >= detector->high))
+        {
+            detector->above = !detector->above;
+            detector->index = index;
+            changes++;
+        }
+    }
+
+    return changes;
+}
+
+//*****************************************************************************
+// Purpose: Integer square root by the bit by bit shift and subtract method.
+// Argument: value - Value
+// Return: Square root, rounded down
+//
+//*****************************************************************************
+
+uint16_t DSP__SquareRoot(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+
+    while(bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while(bit != 0)
+    {
+        if(value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    return (uint16_t)root;
+}
@@ -0,0 +1,116 @@
+// *****************************************************************************
+// *  File: dsp.h
+// *
+// *  Purpose:
+// *  Fixed point signal processing kernels for sample blocks, such as the
+// *  blocks of the ADC10 driver. The MSP430G2x21 has no hardware multiplier,
+// *  every kernel is built from shifts and adds and works on a whole block
+// *  per call to spread the call overhead.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef __DSP_H_
+#define __DSP_H_
+
+#include "libUtility.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_DSP
+
+//*****************************************************************************
+//
+// DSP constants defined here
+//
+//*****************************************************************************
+
+//Samples are signed and limited to +/-2^14, room for 10 bit ADC10 results
+//and oversampled results of up to 14 bits
+#define DSP__MAX_SAMPLE                 16383
+#define DSP__MIN_SAMPLE                 (-16384)
+
+//CIC decimator limits, the register growth of order x rate shift bits must
+//fit the 32 bit integrators alongside the 15 bit samples
+#define DSP__CIC_MAX_ORDER              3
+#define DSP__CIC_MAX_GROWTH             16
+#define DSP__CIC_MAX_SHIFT              15  //Decimation rate fits the 16 bit sample count
+
+//IIR state fraction bits, the filter state is the sample scaled by 2^16
+#define DSP__IIR_FRACTION_BITS          16
+#define DSP__IIR_MAX_SHIFT              15
+
+//IIR response
+#define DSP__IIR_LOWPASS                0
+#define DSP__IIR_HIGHPASS               1   //Input less the low pass response
+
+#define DSP__INVALID_CONFIG             110
+
+//*****************************************************************************
+//
+// DSP data types defined here
+//
+//*****************************************************************************
+
+//Cascaded integrator comb decimator, differential delay of one. Order 1 is a
+//boxcar average of each group of 2^shift samples.
+typedef struct {
+    uint32_t integrator[DSP__CIC_MAX_ORDER];
+    uint32_t comb[DSP__CIC_MAX_ORDER];      //Integrator output at the previous output sample
+    uint8_t order;
+    uint8_t shift;                          //Decimation rate as a power of 2
+    uint16_t count;                         //Input samples into the current output
+} DSP__Cic_t;
+
+//First or second order low pass of cascaded exponential smoothing sections,
+//y += (x - y) / 2^shift for each section. The -3dB point of one section is
+//about sample rate / (2 pi 2^shift).
+typedef struct {
+    int32_t state[2];
+    uint8_t order;
+    uint8_t shift;
+    uint8_t response;
+} DSP__Iir_t;
+
+//Block statistics, accumulated over any number of blocks
+typedef struct {
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+    uint64_t sum_squares;
+    uint16_t count;
+} DSP__Stats_t;
+
+//Threshold detector with hysteresis, the state changes to above on reaching
+//the high threshold and back to below on reaching the low threshold
+typedef struct {
+    int16_t high;
+    int16_t low;
+    bool above;
+    uint16_t index;                         //Block index of the last state change
+} DSP__Threshold_t;
+
+//*****************************************************************************
+//
+// Function prototypes defined here
+//
+//*****************************************************************************
+
+bool DSP__CicInit(DSP__Cic_t *cic, uint8_t order, uint8_t shift);
+uint16_t DSP__CicDecimate(DSP__Cic_t *cic, const int16_t *in, uint16_t length, int16_t *out);
+bool DSP__IirInit(DSP__Iir_t *filter, uint8_t order, uint8_t shift, uint8_t response, int16_t initial);
+void DSP__IirFilter(DSP__Iir_t *filter, const int16_t *in, uint16_t length, int16_t *out);
+void DSP__StatsReset(DSP__Stats_t *stats);
+void DSP__StatsUpdate(DSP__Stats_t *stats, const int16_t *in, uint16_t length);
+int16_t DSP__StatsMean(const DSP__Stats_t *stats);
+uint16_t DSP__StatsRms(const DSP__Stats_t *stats);
+void DSP__ThresholdInit(DSP__Threshold_t *detector, int16_t high, int16_t low, bool above);
+uint16_t DSP__ThresholdDetect(DSP__Threshold_t *detector, const int16_t *in, uint16_t length);
+uint16_t DSP__SquareRoot(uint32_t value);
+
+#endif //__DSP_H_
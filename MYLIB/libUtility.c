@@ -1,167 +1,360 @@
-// *****************************************************************************
-// *  File: libUtility.c
-// *
-// *  Purpose:                                                                         
-// *  General low level library utility functions and facilities are defined here. 
-// *  
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 30/10/2016 
-// *
-// *
-// *
-// *****************************************************************************
-
-#include "libUtility.h"
-
-// Private variables defined here
-
-uint16_t ErrorLogBuffer_ro[LIBUTIL__MAX_ERROR_LOGGED];
-uint8_t LogWriteIndex;
-uint8_t LogNumErrors;
-uint8_t LibErrorFlag;
-
-//*****************************************************************************
-// Purpose: Log error code into the error log buffer, if the buffer is full
-//          the oldest error in the log will be overwritten.
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-static void LogError(uint16_t ErrorCode)
-{
-    uint8_t index;
-    uint8_t replica = FALSE;
-
-    //Check that the same error code has not been logged
-    for(index = 0; index < LIBUTIL__MAX_ERROR_LOGGED; index++)
-    {
-        if(ErrorLogBuffer_ro[index] == ErrorCode)
-        {
-            replica = TRUE;
-        }
-    }   
-
-    if(replica != TRUE)
-    {
-        ErrorLogBuffer_ro[LogWriteIndex] = ErrorCode;
-        
-        LogWriteIndex++; //Increment log write index, any existing error will be overwritten
-
-        //Handle the circular log buffer
-        if(LogWriteIndex >= LIBUTIL__MAX_ERROR_LOGGED)
-        {
-            LogWriteIndex = 0;
-        }    
-
-        if(LogNumErrors < LIBUTIL__MAX_ERROR_LOGGED)
-        {
-            LogNumErrors++;
-        }   
-
-        LibErrorFlag = 1;
-    } 
-
-}
-
-//*****************************************************************************
-// Purpose: Remove specified error code from the error log buffer
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-static void RemoveError(uint8_t ErrorCode)
-{
-    uint8_t index;
-
-    for(index = 0; index < LIBUTIL__MAX_ERROR_LOGGED; index++)
-    {
-        if(ErrorLogBuffer_ro[index] == ErrorCode)
-        {
-            ErrorLogBuffer_ro[index] = 0;
-            LogNumErrors--;
-
-            if(LogNumErrors == 0)
-            {
-                LibErrorFlag = 0;
-            }    
-        }    
-    }    
-}
-
-//*****************************************************************************
-// Purpose: Initialise the error logging function utility
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-static void InitErrorHandling(void)
-{
-    uint8_t index;
-
-    // Initialise the log buffer
-    for(index = 0; index < LIBUTIL__MAX_ERROR_LOGGED; index++)
-    {
-        ErrorLogBuffer_ro[index] = 0;
-    }   
-
-    LibErrorFlag = 0; // Clear the error flag
-    LogWriteIndex = 0; // Set write index to start of log buffer
-    LogNumErrors = 0;
-}
-
-//*****************************************************************************
-// Purpose: Returns the number of errors logged in the error log
-// Argument: None
-// Return: Number of errors logged
-//
-//*****************************************************************************
-
-uint8_t LIBUTIL__GetNumErrors(void)
-{
-    return LogNumErrors;
-}
-
-//*****************************************************************************
-// Purpose: Clear the specified error from the log
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void LIBUTIL__ClearError(uint8_t ErrorCode)
-{
-    RemoveError(ErrorCode);
-}
-
-//*****************************************************************************
-// Purpose: Initialise the library utility
-// Argument: None
-// Return: None
-//
-//*****************************************************************************
-
-void LIBUTIL__Init(void)
-{
-    InitErrorHandling();
-}
-
-
-//*****************************************************************************
-// Purpose: Log error code into the error log buffer, if the buffer is full
-//          the oldest error in the log will be overwritten.
-// Argument: Error code
-// Return: None
-//
-//*****************************************************************************
-
-void LIBUTIL__LogError(uint16_t ErrorCode)
-{
-    LogError(ErrorCode);
-}
-
-
-
+// *****************************************************************************
+// *  File: libUtility.c
+// *
+// *  Purpose:                                                                         
+// *  General low level library utility functions and facilities are defined here. 
+// *  
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 30/10/2016 
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "libUtility.h"
+#include "interrupt.h"
+
+// Private variables defined here
+
+LIBUTIL__ErrorEntry_t ErrorLog_ro[LIBUTIL__MAX_ERROR_LOGGED];
+uint8_t ErrorBitmap_ro[LIBUTIL__ERROR_BITMAP_SIZE];
+uint8_t LogWriteIndex;
+uint8_t LogNumErrors;
+uint8_t LibErrorFlag;
+#if LIBUTIL__ERROR_TIMESTAMPS
+static LIBUTIL__Timestamp_t TimestampSource;
+static LIBUTIL__TimestampConvert_t TimestampConvert;
+#endif
+
+// Public constants defined here
+
+//Index of the lowest set bit of a nibble
+const uint8_t LIBUTIL__NibbleLowestBit[16] = {0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0};
+
+//*****************************************************************************
+// Purpose: Map an error code onto the range covered by the bitmap.
+// Argument: ErrorCode - Error code
+// Return: Error code, LIBUTIL__UNKNOWN_ERROR if out of range
+//
+//*****************************************************************************
+
+static inline uint16_t BitmapCode(uint16_t ErrorCode)
+{
+    if((ErrorCode == 0) || (ErrorCode >= LIBUTIL__MAX_ERROR_CODE))
+    {
+        ErrorCode = LIBUTIL__UNKNOWN_ERROR;
+    }
+
+    return ErrorCode;
+}
+
+//*****************************************************************************
+// Purpose: Check the bitmap for an error code.
+// Argument: ErrorCode - Error code within the bitmap range
+// Return: True if the code is in the log
+//
+//*****************************************************************************
+
+static inline bool CodeLogged(uint16_t ErrorCode)
+{
+    return (ErrorBitmap_ro[ErrorCode >> 3] & (1 << (ErrorCode & 0x07))) != 0;
+}
+
+//*****************************************************************************
+// Purpose: Find the log entry of an error code known to be logged, a search
+//          of at most LIBUTIL__MAX_ERROR_LOGGED entries.
+// Argument: ErrorCode - Error code
+// Return: Log entry
+//
+//*****************************************************************************
+
+static LIBUTIL__ErrorEntry_t *FindEntry(uint16_t ErrorCode)
+{
+    uint8_t index = 0;
+
+    while((index < (LIBUTIL__MAX_ERROR_LOGGED - 1)) && (ErrorLog_ro[index].code != ErrorCode))
+    {
+        index++;
+    }
+
+    return &ErrorLog_ro[index];
+}
+
+//*****************************************************************************
+// Purpose: Log error code into the error log buffer. A code already logged
+//          only has its count and latest timestamp updated, the bitmap tells
+//          a new code apart without searching the log. A new code takes an
+//          entry freed by RemoveError first, if the buffer is full the oldest
+//          error in the log will be overwritten. Safe to call from interrupt
+//          handlers, interrupts are held off for the update only. The raw
+//          timestamp is stored, it is converted when the entry is read.
+// Argument: ErrorCode - Error code
+// Return: None
+//
+//*****************************************************************************
+
+static void LogError(uint16_t ErrorCode)
+{
+    LIBUTIL__ErrorEntry_t *entry;
+#if LIBUTIL__ERROR_TIMESTAMPS
+    uint32_t now = 0;
+#endif
+    uint16_t state;
+    uint8_t index;
+
+    ErrorCode = BitmapCode(ErrorCode);
+    state = INT__EnterCritical();
+
+#if LIBUTIL__ERROR_TIMESTAMPS
+    if(TimestampSource)
+    {
+        now = TimestampSource();
+    }
+#endif
+
+    if(CodeLogged(ErrorCode))
+    {
+        entry = FindEntry(ErrorCode);
+
+        if(entry->count < 0xFFFF)
+        {
+            entry->count++;
+        }
+
+#if LIBUTIL__ERROR_TIMESTAMPS
+        entry->last = now;
+#endif
+    }
+    else
+    {
+        index = LogWriteIndex;
+
+        //Entries are filled in write index order, a free entry elsewhere was
+        //cleared and is taken before the oldest error is overwritten
+        if(LogNumErrors < LIBUTIL__MAX_ERROR_LOGGED)
+        {
+            while(ErrorLog_ro[index].code != 0)
+            {
+                index = (index < (LIBUTIL__MAX_ERROR_LOGGED - 1)) ? (index + 1) : 0;
+            }
+        }
+
+        entry = &ErrorLog_ro[index];
+
+        //Any existing error will be overwritten
+        if(entry->code != 0)
+        {
+            ErrorBitmap_ro[entry->code >> 3] &= ~(1 << (entry->code & 0x07));
+            LogNumErrors--;
+        }
+
+        entry->code = ErrorCode;
+        entry->count = 1;
+#if LIBUTIL__ERROR_TIMESTAMPS
+        entry->first = now;
+        entry->last = now;
+#endif
+        ErrorBitmap_ro[ErrorCode >> 3] |= (1 << (ErrorCode & 0x07));
+        LogNumErrors++;
+
+        //Handle the circular log buffer, the write index stays on the oldest
+        //error when a cleared entry was reused
+        if(index == LogWriteIndex)
+        {
+            LogWriteIndex++;
+
+            if(LogWriteIndex >= LIBUTIL__MAX_ERROR_LOGGED)
+            {
+                LogWriteIndex = 0;
+            }
+        }
+
+        LibErrorFlag = 1;
+    }
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Remove specified error code from the error log buffer
+// Argument: ErrorCode - Error code
+// Return: None
+//
+//*****************************************************************************
+
+static void RemoveError(uint16_t ErrorCode)
+{
+    uint16_t state;
+
+    ErrorCode = BitmapCode(ErrorCode);
+    state = INT__EnterCritical();
+
+    if(CodeLogged(ErrorCode))
+    {
+        FindEntry(ErrorCode)->code = 0;
+        ErrorBitmap_ro[ErrorCode >> 3] &= ~(1 << (ErrorCode & 0x07));
+        LogNumErrors--;
+
+        if(LogNumErrors == 0)
+        {
+            LibErrorFlag = 0;
+        }
+    }
+
+    INT__ExitCritical(state);
+}
+
+//*****************************************************************************
+// Purpose: Initialise the error logging function utility
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+static void InitErrorHandling(void)
+{
+    uint8_t index;
+
+    // Initialise the log buffer
+    for(index = 0; index < LIBUTIL__MAX_ERROR_LOGGED; index++)
+    {
+        ErrorLog_ro[index].code = 0;
+    }
+
+    for(index = 0; index < LIBUTIL__ERROR_BITMAP_SIZE; index++)
+    {
+        ErrorBitmap_ro[index] = 0;
+    }
+
+    LibErrorFlag = 0; // Clear the error flag
+    LogWriteIndex = 0; // Set write index to start of log buffer
+    LogNumErrors = 0;
+#if LIBUTIL__ERROR_TIMESTAMPS
+    TimestampSource = 0;
+    TimestampConvert = 0;
+#endif
+}
+
+//*****************************************************************************
+// Purpose: Returns the number of errors logged in the error log
+// Argument: None
+// Return: Number of errors logged
+//
+//*****************************************************************************
+
+uint8_t LIBUTIL__GetNumErrors(void)
+{
+    return LogNumErrors;
+}
+
+//*****************************************************************************
+// Purpose: Clear the specified error from the log
+// Argument: ErrorCode - Error code
+// Return: None
+//
+//*****************************************************************************
+
+void LIBUTIL__ClearError(uint16_t ErrorCode)
+{
+    RemoveError(ErrorCode);
+}
+
+//*****************************************************************************
+// Purpose: Check whether an error code is in the log.
+// Argument: ErrorCode - Error code
+// Return: True if the code is logged
+//
+//*****************************************************************************
+
+bool LIBUTIL__IsErrorLogged(uint16_t ErrorCode)
+{
+    return CodeLogged(BitmapCode(ErrorCode));
+}
+
+//*****************************************************************************
+// Purpose: Read the occurrence count and timestamps of a logged error code,
+//          the timestamps are converted from the raw clock reads.
+// Argument: ErrorCode - Error code
+//           entry - Copy of the log entry
+// Return: True if the code is logged
+//
+//*****************************************************************************
+
+bool LIBUTIL__GetErrorEntry(uint16_t ErrorCode, LIBUTIL__ErrorEntry_t *entry)
+{
+    bool logged;
+    uint16_t state;
+
+    ErrorCode = BitmapCode(ErrorCode);
+    state = INT__EnterCritical();
+
+    logged = CodeLogged(ErrorCode);
+
+    if(logged)
+    {
+        *entry = *FindEntry(ErrorCode);
+    }
+
+    INT__ExitCritical(state);
+
+#if LIBUTIL__ERROR_TIMESTAMPS
+    if(logged && TimestampConvert)
+    {
+        entry->first = TimestampConvert(entry->first);
+        entry->last = TimestampConvert(entry->last);
+    }
+#endif
+
+    return logged;
+}
+
+#if LIBUTIL__ERROR_TIMESTAMPS
+
+//*****************************************************************************
+// Purpose: Set the clock error timestamps are taken from, errors logged
+//          before a source is set are timestamped 0.
+// Argument: source - Raw timestamp read, safe to call from interrupt handlers
+//           convert - Raw timestamp conversion, 0 to read back raw values
+// Return: None
+//
+//*****************************************************************************
+
+void LIBUTIL__SetTimestampSource(LIBUTIL__Timestamp_t source, LIBUTIL__TimestampConvert_t convert)
+{
+    uint16_t state = INT__EnterCritical();
+
+    TimestampSource = source;
+    TimestampConvert = convert;
+
+    INT__ExitCritical(state);
+}
+
+#endif
+
+//*****************************************************************************
+// Purpose: Initialise the library utility
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void LIBUTIL__Init(void)
+{
+    InitErrorHandling();
+}
+
+
+//*****************************************************************************
+// Purpose: Log error code into the error log buffer, a cleared entry is
+//          reused first and if the buffer is full the oldest error in the log
+//          will be overwritten.
+// Argument: Error code
+// Return: None
+//
+//*****************************************************************************
+
+void LIBUTIL__LogError(uint16_t ErrorCode)
+{
+    LogError(ErrorCode);
+}
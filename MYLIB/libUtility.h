@@ -1,56 +1,142 @@
-// *****************************************************************************
-// *  File: libUtility.h
-// *
-// *  Purpose:                                                                         
-// *  General low level library utility functions and facilities are defined here.  
-// * 
-// *  By: Kevin Wong
-// *  Revision 1.0
-// *  Date: 30/10/2016 
-// *
-// *
-// *
-// *****************************************************************************
-
-#ifndef __LIBUTILITY_H_
-#define __LIBUTILITY_H_
-
-#include <stdint.h>
-#include <stdbool.h>
-
-#define COMPILED_LIBUTIL_CTL
-
-//*****************************************************************************
-//
-// Library utility constants defined here
-// 
-//*****************************************************************************
-
-#define LIBUTIL__MAX_ERROR_LOGGED       5
-
-//*****************************************************************************
-//
-// Generic error codes defined here, driver specific codes defined elsewhere
-// 
-//*****************************************************************************
-
-#define TRUE    1
-#define FALSE   0
-
-//*****************************************************************************
-//
-// Function prototypes defined here
-// 
-//*****************************************************************************
-
-static void LogError(uint16_t ErrorCode);
-static void RemoveError(uint8_t ErrorCode);
-static void InitErrorHandling(void);
-uint8_t LIBUTIL__GetNumErrors(void);
-void LIBUTIL__ClearError(uint8_t ErrorCode);
-void LIBUTIL__Init(void);
-void LIBUTIL__LogError(uint16_t ErrorCode);
-
-
-#endif //__LIBUTILITY_H_
-
+// *****************************************************************************
+// *  File: libUtility.h
+// *
+// *  Purpose:                                                                         
+// *  General low level library utility functions and facilities are defined here.  
+// * 
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 30/10/2016 
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef __LIBUTILITY_H_
+#define __LIBUTILITY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_LIBUTIL_CTL
+
+//*****************************************************************************
+//
+// Library utility constants defined here
+// 
+//*****************************************************************************
+
+#define LIBUTIL__MAX_ERROR_LOGGED       5
+
+//Error codes are tracked in a bitmap, codes from 1 up to this limit. Larger
+//codes are logged as LIBUTIL__UNKNOWN_ERROR.
+#define LIBUTIL__MAX_ERROR_CODE         128
+#define LIBUTIL__ERROR_BITMAP_SIZE      (LIBUTIL__MAX_ERROR_CODE / 8)
+
+//Log entries carry the first and latest occurrence times, 8 bytes of RAM per
+//entry. 0 leaves the timestamps out.
+#ifndef LIBUTIL__ERROR_TIMESTAMPS
+#define LIBUTIL__ERROR_TIMESTAMPS       0
+#endif
+
+//Variables kept through a reset other than power on, left out of the start
+//up clearing. Host builds keep all statics through a simulated reset.
+#if defined MYLIB_HOST_SIM
+#define LIBUTIL__NO_INIT
+#elif defined __IAR_SYSTEMS_ICC__
+#define LIBUTIL__NO_INIT                __no_init
+#elif defined __GNUC__
+#define LIBUTIL__NO_INIT                __attribute__((section(".noinit")))
+#else
+#define LIBUTIL__NO_INIT
+#endif
+
+//*****************************************************************************
+//
+// Generic error codes defined here, driver specific codes defined elsewhere
+// 
+//*****************************************************************************
+
+#define TRUE    1
+#define FALSE   0
+
+#define LIBUTIL__UNKNOWN_ERROR          (LIBUTIL__MAX_ERROR_CODE - 1)
+
+//*****************************************************************************
+//
+// Library utility data types defined here
+// 
+//*****************************************************************************
+
+//Error log entry, one per logged error code
+typedef struct {
+    uint16_t code;              //Error code, 0 for a free entry
+    uint16_t count;             //Occurrences since first logged, saturates
+#if LIBUTIL__ERROR_TIMESTAMPS
+    uint32_t first;             //Timestamp of the first occurrence, raw in the log
+    uint32_t last;              //Timestamp of the latest occurrence, raw in the log
+#endif
+} LIBUTIL__ErrorEntry_t;
+
+//Timestamp source for the error log, a raw clock read cheap enough for
+//interrupt handlers, e.g. the low 32 bits of the uptime count. Called with
+//interrupts disabled.
+typedef uint32_t (*LIBUTIL__Timestamp_t)(void);
+
+//Converts a raw timestamp when an entry is read, e.g. to milliseconds
+typedef uint32_t (*LIBUTIL__TimestampConvert_t)(uint32_t raw);
+
+//*****************************************************************************
+//
+// Bit manipulation helpers defined here
+// 
+//*****************************************************************************
+
+extern const uint8_t LIBUTIL__NibbleLowestBit[16];
+
+//*****************************************************************************
+// Purpose: Return the index of the lowest set bit of a byte, the byte must be
+//          non zero. Table based as the CPU has no count trailing zeros.
+// Argument: value - Byte to test
+// Return: Bit index 0 to 7
+//
+//*****************************************************************************
+
+static inline uint8_t LIBUTIL__LowestSetBit(uint8_t value)
+{
+    uint8_t index;
+
+    if(value & 0x0F)
+    {
+        index = LIBUTIL__NibbleLowestBit[value & 0x0F];
+    }
+    else
+    {
+        index = 4 + LIBUTIL__NibbleLowestBit[value >> 4];
+    }
+
+    return index;
+}
+
+//*****************************************************************************
+//
+// Function prototypes defined here
+// 
+//*****************************************************************************
+
+static void LogError(uint16_t ErrorCode);
+static void RemoveError(uint16_t ErrorCode);
+static void InitErrorHandling(void);
+uint8_t LIBUTIL__GetNumErrors(void);
+void LIBUTIL__ClearError(uint16_t ErrorCode);
+bool LIBUTIL__IsErrorLogged(uint16_t ErrorCode);
+bool LIBUTIL__GetErrorEntry(uint16_t ErrorCode, LIBUTIL__ErrorEntry_t *entry);
+#if LIBUTIL__ERROR_TIMESTAMPS
+void LIBUTIL__SetTimestampSource(LIBUTIL__Timestamp_t source, LIBUTIL__TimestampConvert_t convert);
+#endif
+void LIBUTIL__Init(void);
+void LIBUTIL__LogError(uint16_t ErrorCode);
+
+
+#endif //__LIBUTILITY_H_
+
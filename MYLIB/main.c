@@ -16,17 +16,60 @@
 
 #include "main.h"
 
+//*****************************************************************************
+// Purpose: Scheduler task running the expired soft timer callbacks.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void SoftTimerTask(uint16_t events)
+{
+    (void)events;
+
+    SOFTTMR__ProcessCallbacks();
+}
+
+//*****************************************************************************
+// Purpose: Scheduler task running the application state machine.
+// Argument: events - Pending task events
+// Return: None
+//
+//*****************************************************************************
+
+static void ApplicationTask(uint16_t events)
+{
+    (void)events;
+
+    APPLICATION__Process();
+}
+
 int main(void) {
 
     HW__InitialiseSystem();     //Initialise processor main registers and clock
+#ifdef INT__ISR_STATS
+    INT__ClearIsrStats();       //Handler statistics start empty
+#endif
     INT__EnableInterrupts();    //Enable interrupt generation
 
-    TENMS__Reset();             //Intialise ten milliseond timer driver
-    ONEMS__Reset(); 
+    SOFTTMR__Reset();           //Intialise software timer service
+    UPTIME__Reset();            //Start the uptime clock on the running Timer A
     GPIO_reset();
+    DEBOUNCE__Reset();          //Start sampling debounced inputs
+    DCOCAL__Reset();            //Keep the DCO tuned against the ACLK crystal
+    CRYSTAL__Reset();           //Finish the crystal start up in the background
+    WATCHDOG__Reset();          //Log the reset cause and start the watchdog
+    ADC__Reset();               //ADC10 off until a stream is started
+    SPI__Reset();               //USI SPI master idle with an empty queue
+
+    SCHED__Init();
+    SCHED__RegisterTask(SCHED__SOFTTMR_TASK, SoftTimerTask);
+    SCHED__RegisterTask(SCHED__APPLICATION_TASK, ApplicationTask);
+    SCHED__Post(SCHED__APPLICATION_TASK, SCHED__EVENT_START);
 
-    //Main application loop
-    APPLICATION__Process();  
+    //Main application loop, tasks are run as events are posted and the
+    //device sleeps in between
+    SCHED__Run();
 
 	return 0;
 }
@@ -1,15 +1,25 @@
-
-#ifndef _MAIN_H_
-#define _MAIN_H_
-
-#include "gpio.h"
-#include "interrupt.h"
-#include "hardware_ctl.h"
-#include "tenmillisecond_ctl.h"
-#include "onemillisecond_ctl.h"
-#include "application.h"
-#include <stdint.h>
-
-#endif //_MAIN_H_
-
-
+
+#ifndef _MAIN_H_
+#define _MAIN_H_
+
+#include "gpio.h"
+#include "debounce_ctl.h"
+#include "interrupt.h"
+#include "hardware_ctl.h"
+#include "softtimer_ctl.h"
+#include "tenmillisecond_ctl.h"
+#include "onemillisecond_ctl.h"
+#include "scheduler.h"
+#include "uptime_ctl.h"
+#include "dcocal_ctl.h"
+#include "crystal_ctl.h"
+#include "watchdog_ctl.h"
+#include "adc_ctl.h"
+#include "spi_ctl.h"
+#include "dsp.h"
+#include "application.h"
+#include <stdint.h>
+
+#endif //_MAIN_H_
+
+
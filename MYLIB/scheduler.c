@@ -0,0 +1,151 @@
+// *****************************************************************************
+// *  File: scheduler.c
+// *
+// *  Purpose:
+// *  Cooperative run-to-completion task scheduler. Each task has a pending
+// *  event bitmask and a bit in the ready mask, the lowest set bit of the ready
+// *  mask is the highest priority task to run.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#include "scheduler.h"
+#include "interrupt.h"
+#include "hardware_ctl.h"
+
+// Private variables defined here
+
+static SCHED__Task_t TaskFunction[SCHED__NUM_TASKS];
+static volatile uint16_t TaskEvents[SCHED__NUM_TASKS];
+static volatile uint8_t ReadyMask;
+
+#if (SCHED__NUM_TASKS <= SCHED__MAX_TASKS)
+
+//*****************************************************************************
+// Purpose: Initialise the scheduler with no tasks registered or pending.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SCHED__Init(void)
+{
+    uint8_t index;
+
+    for(index = 0; index < SCHED__NUM_TASKS; index++)
+    {
+        TaskFunction[index] = 0;
+        TaskEvents[index] = 0;
+    }
+
+    ReadyMask = 0;
+}
+
+//*****************************************************************************
+// Purpose: Register the function run for a task.
+// Argument: taskId - Task ID, also the task priority
+//           task - Task function
+// Return: None
+//
+//*****************************************************************************
+
+void SCHED__RegisterTask(uint8_t taskId, SCHED__Task_t task)
+{
+    if(taskId < SCHED__NUM_TASKS)
+    {
+        TaskFunction[taskId] = task;
+    }
+    else
+    {
+        LIBUTIL__LogError(SCHED__INVALID_TASK_ID);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Post events to a task, the task is made ready to run. Safe to call
+//          from interrupt handlers, the interrupt handler must leave low power
+//          mode on exit for the scheduler to run the task.
+// Argument: taskId - Task ID
+//           events - Event bitmask merged into the pending task events
+// Return: None
+//
+//*****************************************************************************
+
+void SCHED__Post(uint8_t taskId, uint16_t events)
+{
+    uint16_t state;
+
+    if(taskId < SCHED__NUM_TASKS)
+    {
+        state = INT__EnterCritical();
+        TaskEvents[taskId] |= events;
+        ReadyMask |= (1 << taskId);
+        INT__ExitCritical(state);
+    }
+    else
+    {
+        LIBUTIL__LogError(SCHED__INVALID_TASK_ID);
+    }
+}
+
+//*****************************************************************************
+// Purpose: Check if any task has pending events, used by interrupt handlers
+//          to decide whether to wake the scheduler.
+// Argument: None
+// Return: true if a task is ready to run
+//
+//*****************************************************************************
+
+bool SCHED__TaskReady(void)
+{
+    return (ReadyMask != 0);
+}
+
+//*****************************************************************************
+// Purpose: Scheduler main loop, never returns. Ready tasks are run to
+//          completion in priority order, the device sleeps in low power mode
+//          when no task is ready.
+// Argument: None
+// Return: None
+//
+//*****************************************************************************
+
+void SCHED__Run(void)
+{
+    uint8_t taskId;
+    uint16_t events;
+
+    while(1)
+    {
+        //Interrupts are disabled so a post can not be missed between the
+        //ready check and entering low power mode
+        INT__DisableInterrupts();
+
+        if(ReadyMask == 0)
+        {
+            HW__EnterLowpower();    //Interrupts enabled on entry, woken by interrupt handler
+        }
+        else
+        {
+            taskId = LIBUTIL__LowestSetBit(ReadyMask);    //Highest priority ready task
+            events = TaskEvents[taskId];
+            TaskEvents[taskId] = 0;
+            ReadyMask &= ~(1 << taskId);
+            INT__EnableInterrupts();
+
+            if(TaskFunction[taskId] != 0)
+            {
+                TaskFunction[taskId](events);
+            }
+        }
+    }
+}
+
+#else
+    #error "scheduler.c: Max number of tasks exceeded!"
+#endif
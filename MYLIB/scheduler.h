@@ -0,0 +1,75 @@
+// *****************************************************************************
+// *  File: scheduler.h
+// *
+// *  Purpose:
+// *  Cooperative run-to-completion task scheduler. Tasks are posted event
+// *  bitmasks from interrupt handlers or other tasks, the highest priority
+// *  task with pending events is run and the device is put into low power mode
+// *  when no task is ready.
+// *
+// *  By: Kevin Wong
+// *  Revision 1.0
+// *  Date: 17/10/2026
+// *
+// *
+// *
+// *****************************************************************************
+
+#ifndef __SCHEDULER_H_
+#define __SCHEDULER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COMPILED_SCHEDULER
+
+//*****************************************************************************
+//
+// Tasks defined and registered here, tasks are listed in priority order with
+// the highest priority task first. A maximum of 8 tasks is supported.
+//
+//*****************************************************************************
+
+enum
+{
+    SCHED__SOFTTMR_TASK = 0,        //Runs expired soft timer callbacks
+    SCHED__APPLICATION_TASK,        //Application state machine
+    SCHED__NUM_TASKS
+};
+
+//*****************************************************************************
+//
+// Scheduler constants defined here
+//
+//*****************************************************************************
+
+#define SCHED__MAX_TASKS                8
+
+//Generic task events, task specific events are defined by the task owner
+#define SCHED__EVENT_START              0x0001  //Posted once when the task is started
+#define SCHED__EVENT_SOFTTMR_CALLBACK   0x0002  //Soft timer callbacks are queued
+
+#define SCHED__INVALID_TASK_ID          50
+
+//*****************************************************************************
+//
+// Scheduler data types defined here
+//
+//*****************************************************************************
+
+//Task function, called with all of the events posted since it last ran
+typedef void (*SCHED__Task_t)(uint16_t events);
+
+//*****************************************************************************
+//
+// Function prototypes defined here
+//
+//*****************************************************************************
+
+void SCHED__Init(void);
+void SCHED__RegisterTask(uint8_t taskId, SCHED__Task_t task);
+void SCHED__Post(uint8_t taskId, uint16_t events);
+bool SCHED__TaskReady(void);
+void SCHED__Run(void);
+
+#endif //__SCHEDULER_H_